@@ -64,6 +64,7 @@ namespace SIM
     solver.fastForward(time/solver.getTimePrm().time.dt);
     for (int i=steps;i>=0;--i) {
       reader.loadTimeLevel(max-i,xml,hdf);
+      simulator.fieldsUpdated();
       solver.postSolve(solver.getTimePrm(),true);
       if (i > 0) solver.advanceStep();
     }
@@ -77,6 +78,9 @@ namespace SIM
   //! \param[in] append Whether or not to append to file
   //! \param[in] interval The stride in the output file
   //! \param[in] steps The number of time steps to dump in onw row
+  //!
+  //! \details The HDF5 layout and asynchronous output are configured by the
+  //! attributes of the \a hdf5 tag or the corresponding command-line options.
   template<class Simulator, class Solver>
   DataExporter* handleDataOutput(Simulator& simulator, Solver& solver,
                                  const std::string& hdf5file,
@@ -86,6 +90,13 @@ namespace SIM
     DataExporter* writer = new DataExporter(true,interval,steps);
     XMLWriter* xml = new XMLWriter(hdf5file,solver.getProcessAdm());
     HDF5Writer* hdf = new HDF5Writer(hdf5file,solver.getProcessAdm(),append);
+    const SIMoptions& opt = IFEM::getOptions();
+    if (opt.hdf5Layout > 1)
+      hdf->setCollective(opt.hdf5Deflate);
+    else if (opt.hdf5Layout > 0)
+      hdf->setConsolidated(opt.hdf5Deflate);
+    if (opt.hdf5Async > 0)
+      hdf->setAsync(opt.hdf5Async);
     writer->registerWriter(xml);
     writer->registerWriter(hdf);
     simulator.registerFields(*writer);
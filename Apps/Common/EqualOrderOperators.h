@@ -137,6 +137,29 @@ public:
     //! \param[in] basis Basis to use
     static void Source(Vector& EV, const FiniteElement& fe,
                        const Vec3& f, double scale=1.0, int basis=1);
+
+    //! \brief Compute a laplacian for all integration points of an element.
+    //! \param[out] EM The element matrix to add contribution to
+    //! \param[in] fe The finite element batch to evaluate for
+    //! \param[in] scale Scaling factor for contribution
+    //! \param[in] stress Whether to add extra stress formulation terms
+    static void Laplacian(Matrix& EM, const FiniteElementBatch& fe,
+                          double scale=1.0, bool stress=false);
+
+    //! \brief Compute a mass term for all integration points of an element.
+    //! \param[out] EM The element matrix to add contribution to
+    //! \param[in] fe The finite element batch to evaluate for
+    //! \param[in] scale Scaling factor for contribution
+    static void Mass(Matrix& EM, const FiniteElementBatch& fe,
+                     double scale=1.0);
+
+    //! \brief Compute a source term for all integration points of an element.
+    //! \param[out] EV The element vector to add contribution to
+    //! \param[in] fe The finite element batch to evaluate for
+    //! \param[in] scale Scaling factor for contribution
+    //! \param[in] cmp Component to add (0 for all)
+    static void Source(Vector& EV, const FiniteElementBatch& fe,
+                       double scale=1.0, int cmp=1);
   };
 
   //! \brief Common weak residual operators using equal-ordered discretizations.
@@ -0,0 +1,144 @@
+// $Id$
+//==============================================================================
+//!
+//! \file InterfaceAccelerator.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author SINTEF Digital
+//!
+//! \brief Convergence acceleration of partitioned coupling iterations.
+//!
+//==============================================================================
+
+#ifndef _INTERFACE_ACCELERATOR_H
+#define _INTERFACE_ACCELERATOR_H
+
+#include "MatVec.h"
+#include <deque>
+#include <string>
+
+class ProcessAdm;
+class SIMbase;
+class TiXmlElement;
+
+
+/*!
+  \brief Class for accelerating fixed-point iterations on an interface field.
+
+  \details In each subiteration, the field \f$\tilde{\bf x}_k\f$ computed by
+  the coupled solvers from the previous field value \f${\bf x}_k\f$ is replaced
+  by an updated value \f${\bf x}_{k+1}\f$ before the next subiteration.
+  The following methods are available:
+  - Dynamic Aitken relaxation,
+    \f${\bf x}_{k+1} = {\bf x}_k + \omega_k{\bf r}_k\f$ with
+    \f$\omega_k = -\omega_{k-1}\frac{{\bf r}_{k-1}\cdot({\bf r}_k-{\bf r}_{k-1})}
+    {|{\bf r}_k-{\bf r}_{k-1}|^2}\f$, where
+    \f${\bf r}_k = \tilde{\bf x}_k - {\bf x}_k\f$ is the residual.
+  - Interface quasi-Newton with an inverse Jacobian from a least-squares
+    model (IQN-ILS). The differences of the residuals and of the computed
+    fields from the iterations are stored in the columns of the matrices
+    \b V and \b W, and \f${\bf x}_{k+1} = \tilde{\bf x}_k + {\bf W}{\bf c}\f$,
+    where \b c minimizes \f$|{\bf V}{\bf c} + {\bf r}_k|\f$.
+    The columns from a given number of previous time steps may be reused.
+
+  The first iteration of each time step uses constant relaxation.
+
+  In parallel runs, the inner products are summed over all processes,
+  and each interface DOF is counted by the process owning it only,
+  see setDomain. All processes then compute the same update.
+*/
+
+class InterfaceAccelerator
+{
+public:
+  //! \brief Enum defining the available acceleration methods.
+  enum Method
+  {
+    NONE    = 0, //!< No acceleration, plain fixed-point iterations
+    CONST   = 1, //!< Constant relaxation
+    AITKEN  = 2, //!< Dynamic Aitken relaxation
+    IQN_ILS = 3  //!< Interface quasi-Newton with least-squares model
+  };
+
+  //! \brief Default constructor.
+  InterfaceAccelerator();
+
+  //! \brief Configures the acceleration.
+  //! \param[in] name Name of the interface field to accelerate
+  //! \param[in] m The acceleration method to use
+  //! \param[in] omega Relaxation factor of the first iteration in each step
+  //! \param[in] nReuse Number of previous time steps to reuse IQN-ILS data from
+  void setup(const std::string& name, Method m,
+             double omega = 0.5, int nReuse = 0);
+
+  //! \brief Parses the acceleration setup from an XML element.
+  bool parse(const TiXmlElement* elem);
+
+  //! \brief Defines the parallel distribution of the interface field.
+  //! \param[in] owned Flags the DOFs of the field owned by this process
+  //! \param[in] adm Process administrator to reduce the inner products over
+  void setDomain(const std::vector<bool>& owned,
+                 const ProcessAdm* adm = nullptr);
+  //! \brief Defines the parallel distribution from the simulator of the field.
+  //! \param[in] sim The simulator the interface field is a solution vector of
+  //! \details The DOFs of the nodes owned by this process are flagged, using
+  //! the domain decomposition of the simulator. Does nothing in serial runs.
+  void setDomain(const SIMbase& sim);
+
+  //! \brief Returns \e true if the acceleration is enabled.
+  bool active() const { return method != NONE && !field.empty(); }
+  //! \brief Returns the name of the accelerated field.
+  const std::string& getField() const { return field; }
+  //! \brief Returns the acceleration method.
+  Method getMethod() const { return method; }
+
+  //! \brief Initializes for the subiterations of a new time step.
+  //! \param[in] x Interface field value used in the first subiteration
+  void initStep(const Vector& x);
+
+  //! \brief Computes the interface field value for the next subiteration.
+  //! \param x The computed field on input, the updated field on output
+  //! \return \e false if the field size changed within the time step
+  bool update(Vector& x);
+
+  //! \brief Returns the last relaxation factor used.
+  double getOmega() const { return omega; }
+  //! \brief Returns the number of columns in the IQN-ILS least-squares model.
+  size_t getNoColumns() const { return V.size(); }
+
+private:
+  //! \brief Computes the IQN-ILS update.
+  //! \param[in] r The current residual
+  //! \param x The computed field on input, the updated field on output
+  //! \return \e false if no linearly independent columns are available
+  bool solveLeastSquares(const Vector& r, Vector& x);
+
+  //! \brief Returns the global inner product of two interface vectors.
+  double dot(const Vector& a, const Vector& b) const;
+  //! \brief Returns the global Euclidean norm of an interface vector.
+  double norm(const Vector& a) const { return sqrt(this->dot(a,a)); }
+
+  std::string field;  //!< Name of the accelerated field
+  Method      method; //!< The acceleration method
+  double      omega0; //!< Relaxation factor of the first iteration
+  int         reuse;  //!< Number of previous time steps to reuse columns from
+
+  double omega; //!< Current relaxation factor
+  int    iter;  //!< Subiteration counter within current time step
+  int    step;  //!< Time step counter
+
+  Vector xPrev;  //!< Field value used in the last subiteration
+  Vector rPrev;  //!< Residual of the previous subiteration
+  Vector xtPrev; //!< Computed field of the previous subiteration
+
+  std::deque<Vector> V; //!< Residual differences, newest first
+  std::deque<Vector> W; //!< Computed field differences, newest first
+  std::deque<int>    S; //!< Time step of each column
+
+  std::vector<bool> owned;   //!< Flags the interface DOFs owned by this process
+  const ProcessAdm* adm;     //!< Process administrator of the interface field
+  size_t            nGlbDof; //!< Global number of interface DOFs
+};
+
+#endif
@@ -19,6 +19,8 @@
 #include <GoTools/geometry/SplineSurface.h>
 #include <GoTools/trivariate/SplineVolume.h>
 
+class Vec3;
+
 
 /*!
   \brief 1D multi-patch model generator for FEM simulators.
@@ -100,6 +102,23 @@ protected:
   virtual std::string createG2(int nsd) const;
 
 private:
+  //! \brief Parses the block geometry from the XML input.
+  //! \param[out] X0 Lower-left corner of the model
+  //! \param[out] L Size of each block
+  //! \return \e true if a rational basis is requested
+  bool getBlockGeometry(Vec3& X0, Vec3& L) const;
+
+  //! \brief Creates the bilinear spline surface of one block.
+  //! \param[in] nsd Number of spatial dimensions
+  //! \param[in] rational If \e true, create a rational spline
+  //! \param[in] X0 Lower-left corner of the model
+  //! \param[in] L Size of each block
+  //! \param[in] x Block index in x-direction
+  //! \param[in] y Block index in y-direction
+  static Go::SplineSurface createBlock(int nsd, bool rational,
+                                       const Vec3& X0, const Vec3& L,
+                                       int x, int y);
+
   size_t nx; //!< Number of blocks in x
   size_t ny; //!< Number of blocks in y
   int periodic_x; //!< If non-zero, make model periodic in x for given bases
@@ -151,6 +170,23 @@ protected:
   virtual std::string createG2(int) const;
 
 private:
+  //! \brief Parses the block geometry from the XML input.
+  //! \param[out] X0 Lower-left corner of the model
+  //! \param[out] L Size of each block
+  //! \return \e true if a rational basis is requested
+  bool getBlockGeometry(Vec3& X0, Vec3& L) const;
+
+  //! \brief Creates the trilinear spline volume of one block.
+  //! \param[in] rational If \e true, create a rational spline
+  //! \param[in] X0 Lower-left corner of the model
+  //! \param[in] L Size of each block
+  //! \param[in] x Block index in x-direction
+  //! \param[in] y Block index in y-direction
+  //! \param[in] z Block index in z-direction
+  static Go::SplineVolume createBlock(bool rational,
+                                      const Vec3& X0, const Vec3& L,
+                                      int x, int y, int z);
+
   size_t nx; //!< Number of blocks in x
   size_t ny; //!< Number of blocks in y
   size_t nz; //!< Number of blocks in z
@@ -49,22 +49,38 @@ public:
   //! \brief Advances the time step one step forward.
   virtual bool advanceStep(TimeStep& tp)
   {
-    return S1.advanceStep(tp) && S2.advanceStep(tp);
+    if (!S1.advanceStep(tp))
+      return false;
+
+    S1.fieldsUpdated();
+    if (!S2.advanceStep(tp))
+      return false;
+
+    S2.fieldsUpdated();
+    return true;
   }
 
   //! \brief Computes the solution for the current time step.
   virtual bool solveStep(TimeStep& tp, bool firstS1 = true)
   {
     if (firstS1)
-      return S1.solveStep(tp) && S2.solveStep(tp);
+      return this->solveSingle(S1,tp) && this->solveSingle(S2,tp);
     else
-      return S2.solveStep(tp) && S1.solveStep(tp);
+      return this->solveSingle(S2,tp) && this->solveSingle(S1,tp);
   }
 
   //! \brief Postprocesses the solution of current time step.
   bool postSolve(const TimeStep& tp, bool restart = false)
   {
-    return S1.postSolve(tp,restart) && S2.postSolve(tp,restart);
+    if (!S1.postSolve(tp,restart))
+      return false;
+
+    S1.fieldsUpdated();
+    if (!S2.postSolve(tp,restart))
+      return false;
+
+    S2.fieldsUpdated();
+    return true;
   }
 
   //! \brief Saves the converged results to VTF-file of a given time step.
@@ -89,7 +105,11 @@ public:
   //! \brief Initializes for time-dependent simulation.
   virtual bool init(const TimeStep& tp)
   {
-    return S1.init(tp) && S2.init(tp);
+    if (!S1.init(tp) || !S2.init(tp))
+      return false;
+
+    this->fieldsUpdated();
+    return true;
   }
 
   //! \brief Registers a dependency on a field from another SIM object.
@@ -139,7 +159,11 @@ public:
   //! \brief Sets the initial conditions for the simulators.
   bool setInitialConditions()
   {
-    return S1.setInitialConditions() && S2.setInitialConditions();
+    if (!S1.setInitialConditions() || !S2.setInitialConditions())
+      return false;
+
+    this->fieldsUpdated();
+    return true;
   }
 
   //! \brief Checks whether a named initial condition is present.
@@ -158,7 +182,34 @@ public:
     return result;
   }
 
+  //! \brief Marks a version-stamped field as modified.
+  void fieldUpdated(const std::string& name)
+  {
+    S1.fieldUpdated(name);
+    S2.fieldUpdated(name);
+  }
+
+  //! \brief Marks all version-stamped fields of both simulators as modified.
+  void fieldsUpdated()
+  {
+    S1.fieldsUpdated();
+    S2.fieldsUpdated();
+  }
+
 protected:
+  //! \brief Solves one of the simulators and stamps its fields as modified.
+  //! \details The fields of \a S are bumped even if its solveStep does not
+  //! go through SIMbase::solveSystem, such that the other simulator
+  //! re-extracts the dependent fields in its next solve.
+  template<class T> static bool solveSingle(T& S, TimeStep& tp)
+  {
+    if (!S.solveStep(tp))
+      return false;
+
+    S.fieldsUpdated();
+    return true;
+  }
+
   T1& S1; //!< First substep
   T2& S2; //!< Second substep
 };
@@ -16,14 +16,29 @@
 
 #include "SIMCoupled.h"
 #include "SIMenums.h"
+#include "InterfaceAccelerator.h"
+#include "XMLInputBase.h"
+#include "Utilities.h"
+#include "tinyxml.h"
+#include <cstring>
 
 
 /*!
   \brief Template class for semi-implicitly coupled simulators.
+
+  \details The subiterations may be accelerated by relaxation or an interface
+  quasi-Newton method, see InterfaceAccelerator. The accelerated field should
+  be the one computed by the last solver in each subiteration, and it is
+  updated in place such that the first solver uses the updated value.
+
+  The acceleration is configured by the \a acceleration tag within the
+  \a coupling tag of the input file, which is read by the readXML method.
+  In parallel runs, setAccelerationDomain must be invoked after the
+  preprocessing, with the simulator owning the accelerated field.
 */
 
 template<class T1, class T2>
-class SIMCoupledSI : public SIMCoupled<T1, T2>
+class SIMCoupledSI : public SIMCoupled<T1, T2>, public XMLInputBase
 {
 public:
   //! \brief The constructor forwards to the parent class constructor.
@@ -31,6 +46,25 @@ public:
   //! \brief Empty destructor.
   virtual ~SIMCoupledSI() {}
 
+  //! \brief Enables acceleration of the subiterations.
+  //! \param[in] field Name of the interface field to accelerate
+  //! \param[in] method The acceleration method to use
+  //! \param[in] omega Relaxation factor of the first iteration in each step
+  //! \param[in] reuse Number of previous time steps to reuse IQN-ILS data from
+  void setAcceleration(const std::string& field,
+                       InterfaceAccelerator::Method method,
+                       double omega = 0.5, int reuse = 0)
+  {
+    accel.setup(field,method,omega,reuse);
+  }
+
+  //! \brief Parses the subiteration acceleration setup from an XML element.
+  bool parseAcceleration(const TiXmlElement* elem) { return accel.parse(elem); }
+
+  //! \brief Defines the parallel distribution of the accelerated field.
+  //! \param[in] sim The simulator the accelerated field is a solution of
+  void setAccelerationDomain(const SIMbase& sim) { accel.setDomain(sim); }
+
   //! \brief Computes the solution for the current time step.
   virtual bool solveStep(TimeStep& tp, bool firstS1 = true)
   {
@@ -40,25 +74,53 @@ public:
     this->S1.getProcessAdm().cout <<"\n  step="<< tp.step
                                   <<"  time="<< tp.time.t << std::endl;
 
+    utl::vector<double>* ifield = nullptr;
+    if (accel.active() && !(ifield = this->getField(accel.getField())))
+      std::cerr <<"  ** SIMCoupledSI::solveStep: No field named \""
+                << accel.getField() <<"\", no acceleration."<< std::endl;
+    else if (ifield)
+      accel.initStep(*ifield);
+
     SIM::ConvStatus status1 = SIM::OK, status2 = SIM::OK, conv = SIM::OK;
     for (tp.iter = 0; tp.iter <= maxIter && conv != SIM::CONVERGED; tp.iter++)
     {
       if (firstS1 && (status1 = this->S1.solveIteration(tp)) <= SIM::DIVERGED)
         return false;
+      else if (firstS1)
+        this->S1.fieldsUpdated();
 
       if ((status2 = this->S2.solveIteration(tp)) <= SIM::DIVERGED)
         return false;
+      this->S2.fieldsUpdated();
 
       if (!firstS1 && (status1 = this->S1.solveIteration(tp)) <= SIM::DIVERGED)
         return false;
+      else if (!firstS1)
+        this->S1.fieldsUpdated();
 
       if ((conv = this->checkConvergence(tp,status1,status2)) <= SIM::DIVERGED)
         return false;
+
+      if (ifield && conv != SIM::CONVERGED && tp.iter < maxIter)
+      {
+        if (!accel.update(*ifield))
+          return false;
+        this->fieldUpdated(accel.getField());
+
+        if (accel.getMethod() == InterfaceAccelerator::IQN_ILS)
+          this->S1.getProcessAdm().cout <<"  IQN-ILS update with "
+                                        << accel.getNoColumns()
+                                        <<" columns"<< std::endl;
+        else
+          this->S1.getProcessAdm().cout <<"  Relaxation factor: "
+                                        << accel.getOmega() << std::endl;
+      }
     }
 
     tp.time.first = false;
     this->S1.postSolve(tp);
     this->S2.postSolve(tp);
+    this->fieldsUpdated();
 
     return true;
   }
@@ -81,7 +143,26 @@ public:
   }
 
 protected:
-  int maxIter; // Maximum number of iterations
+  //! \brief Parses a data section from an XML element.
+  //! \details Only the \a coupling tag is considered, the other tags are
+  //! parsed by the coupled simulators.
+  virtual bool parse(const TiXmlElement* elem)
+  {
+    if (strcasecmp(elem->Value(),"coupling"))
+      return true;
+
+    utl::getAttribute(elem,"maxIter",maxIter);
+    const TiXmlElement* child = elem->FirstChildElement("acceleration");
+    for (; child; child = child->NextSiblingElement("acceleration"))
+      if (!this->parseAcceleration(child))
+        return false;
+
+    return true;
+  }
+
+  int maxIter; //!< Maximum number of iterations
+
+  InterfaceAccelerator accel; //!< Acceleration of the subiterations
 };
 
 #endif
@@ -101,6 +101,21 @@ public:
     return const_cast<const T&>(base).getField(name);
   }
 
+  //! \copydoc SIMdependency::fieldUpdated(const std::string&)
+  virtual void fieldUpdated(const std::string& name)
+  {
+    base.fieldUpdated(name);
+  }
+
+  //! \copydoc SIMdependency::fieldsUpdated()
+  virtual void fieldsUpdated() { base.fieldsUpdated(); }
+
+  //! \copydoc SIMdependency::getFieldVersion(const std::string&) const
+  virtual unsigned int getFieldVersion(const std::string& name) const
+  {
+    return base.getFieldVersion(name);
+  }
+
   //! \copydoc SIMdependency::getDependentField(const std::string&) const
   const utl::vector<double>* getDependentField(const std::string& name) const
   {
@@ -27,6 +27,11 @@
 #include "tinyxml.h"
 #include <fstream>
 #include <memory>
+#include <set>
+#include <sstream>
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
 
 class TimeStep;
 class VTF;
@@ -39,6 +44,15 @@ extern std::vector< std::shared_ptr<std::ostream> > plane_log_files;
 
 /*!
   \brief Driver class for plane-decoupled 3D problems.
+
+  \details The planes assigned to a process may be solved concurrently by
+  specifying the number of threads to use over the planes (the \a plane_threads
+  attribute). This requires that each plane solver has its own integrand,
+  and is only available with OpenMP and without PETSc. The screen output from
+  the planes is then buffered and written in plane order after each step.
+  The process-wide state used by the plane solvers, i.e., the profiler and
+  the global IFEM::cout stream, is safe for concurrent use. The output
+  written to IFEM::cout is not buffered per plane, and may be interleaved.
 */
 
 template<class PlaneSolver>
@@ -51,7 +65,7 @@ public:
   //! \brief The constructor initializes the setup properties.
   SIMSemi3D(const SetupProps& props_) :
     startCtx(0), planes(1), procs_per_plane(1), output_plane(-1),
-    direction('Z'), props(props_)
+    plane_threads(1), direction('Z'), props(props_)
   {
     SIMadmin::myHeading = "Plane-decoupled 3D simulation driver";
   }
@@ -59,14 +73,19 @@ public:
   //! \brief The destructor deletes the plane-wise sub-step solvers.
   virtual ~SIMSemi3D()
   {
-    if (!m_planes.empty())
-      delete m_planes.front();
+    if (m_planes.empty())
+      return;
+
+    const void* problem = m_planes.front()->getProblem();
+    delete m_planes.front();
 
     for (size_t i = 1; i < m_planes.size(); i++)
     {
-      // The other planes do not own the integrand, so clear the pointer to it
-      // to avoid that the SIMbase destructor tries to delete it again
-      m_planes[i]->clearProblem();
+      // Planes sharing the integrand with the first plane do not own it,
+      // so clear the pointer to it to avoid that the SIMbase destructor
+      // tries to delete it again
+      if (m_planes[i]->getProblem() == problem)
+        m_planes[i]->clearProblem();
       delete m_planes[i];
     }
   }
@@ -74,9 +93,16 @@ public:
   //! \brief Advances the time step one step forward.
   bool advanceStep(TimeStep& tp)
   {
-    bool ok = true;
-    for (size_t i = 0; i < m_planes.size() && ok; i++)
-      ok = m_planes[i]->advanceStep(tp);
+    // Each plane needs its own copy of the time step when solved concurrently
+    std::vector<TimeStep> tps(plane_threads > 1 ? m_planes.size() : 0, tp);
+    bool ok = this->forAllPlanes([this,&tp,&tps](size_t i)
+    {
+      return m_planes[i]->advanceStep(tps.empty() ? tp : tps[i]);
+    });
+
+    // The time step is advanced equally for all planes
+    if (!tps.empty())
+      tp = tps.front();
 
     return ok;
   }
@@ -97,12 +123,25 @@ public:
   void printFinalNorms(const TimeStep&) {}
 
   //! \brief Performs some pre-processing tasks on the FE model.
+  //! \details The planes are preprocessed sequentially, since the global
+  //! node numbering of the patches is not thread safe.
   bool preprocess()
   {
     for (size_t i=0;i<m_planes.size();++i)
       if (!m_planes[i]->preprocess())
         return false;
 
+    // Concurrent plane solves require separate integrands for each plane
+    std::set<const void*> problems;
+    for (size_t i = 0; i < m_planes.size(); i++)
+      problems.insert(m_planes[i]->getProblem());
+    if (plane_threads > 1 && problems.size() < m_planes.size())
+    {
+      IFEM::cout <<"  ** SIMSemi3D::preprocess: The planes share integrand,"
+                 <<" solving them sequentially."<< std::endl;
+      plane_threads = 1;
+    }
+
     this->grabPlaneNodes();
     return true;
   }
@@ -149,13 +188,12 @@ public:
   }
 
   //! \brief Initializes for time-dependent simulation.
+  //! \details The plane solvers only read the time step, so it is shared
+  //! by the planes also when they are initialized concurrently.
   bool init(const TimeStep& tp)
   {
-    bool ok = true;
-    for (size_t i = 0; i < m_planes.size() && ok; i++)
-      ok = m_planes[i]->init(tp);
-
-    return ok;
+    return this->forAllPlanes([this,&tp](size_t i)
+                              { return m_planes[i]->init(tp); });
   }
 
   //! \brief Dummy method (VTF export is not supported).
@@ -175,23 +213,28 @@ public:
   //! \brief Solves the nonlinear equations by Newton-Raphson iterations.
   bool solveStep(TimeStep& tp)
   {
-    bool ok = true;
-    for (size_t i = 0; i < m_planes.size() && ok; i++) {
+    // Each plane needs its own copy of the time step when solved concurrently
+    std::vector<TimeStep> tps(plane_threads > 1 ? m_planes.size() : 0, tp);
+    bool ok = this->forAllPlanes([this,&tp,&tps](size_t i)
+    {
       m_planes[i]->getProcessAdm().cout <<"\n  Plane = "<< startCtx+i+1 <<":";
-      ok = m_planes[i]->solveStep(tp);
-    }
+      return m_planes[i]->solveStep(tps.empty() ? tp : tps[i]);
+    });
+
+    // The iteration counters etc. are reported from the first plane
+    if (!tps.empty())
+      tp = tps.front();
 
     return ok;
   }
 
   //! \brief Extracts the velocity vector from the nonlinear solution vector.
+  //! \details The plane solvers only read the time step, so it is shared
+  //! by the planes also when they are post-processed concurrently.
   bool postSolve(const TimeStep& tp, bool restart = false)
   {
-    bool ok = true;
-    for (size_t i = 0; i < m_planes.size() && ok; i++)
-      ok = m_planes[i]->postSolve(tp,restart);
-
-    return ok;
+    return this->forAllPlanes([this,&tp,restart](size_t i)
+                              { return m_planes[i]->postSolve(tp,restart); });
   }
 
   //! \brief Sets the initial conditions.
@@ -279,6 +322,15 @@ public:
 
     utl::getAttribute(elem,"output_prefix", log_files);
     utl::getAttribute(elem,"output_plane", output_plane);
+    utl::getAttribute(elem,"plane_threads", plane_threads);
+#if defined(USE_OPENMP) && !defined(HAS_PETSC)
+    if (plane_threads > omp_get_max_threads())
+      plane_threads = omp_get_max_threads();
+#else
+    plane_threads = 1;
+#endif
+    if (plane_threads < 1)
+      plane_threads = 1;
 
     IFEM::cout <<"\tSemi3D: "<< direction
                <<" "<< planes <<" planes, "<< procs_per_plane
@@ -291,6 +343,9 @@ public:
     if (!log_files.empty())
       IFEM::cout <<"\tSemi3D: Logging to files with prefix "
                  << log_files <<"."<< std::endl;
+    if (plane_threads > 1)
+      IFEM::cout <<"\tSemi3D: Solving "<< plane_threads
+                 <<" planes concurrently."<< std::endl;
 
     return true;
   }
@@ -370,7 +425,60 @@ public:
   //! \brief Dummy method.
   int getGlobalNode(int node) const { return -1; }
 
+  //! \brief Returns the number of planes that are solved concurrently.
+  int getPlaneThreads() const { return plane_threads; }
+
 protected:
+  //! \brief Returns \e true if the screen output of a plane is enabled.
+  //! \param[in] i Process-local plane index
+  bool onScreen(size_t i) const
+  {
+    return output_plane == -1 || output_plane == (int)(startCtx+i+1);
+  }
+
+  //! \brief Invokes an operation on all planes of this process.
+  //! \param[in] func The operation, taking the process-local plane index
+  //!
+  //! \details When solving the planes sequentially, this stops at the first
+  //! plane where the operation fails. Otherwise, the operation is invoked on
+  //! all planes concurrently, with the screen output buffered for each plane.
+  template<class Func>
+  bool forAllPlanes(const Func& func)
+  {
+    if (plane_threads < 2 || m_planes.size() < 2)
+    {
+      for (size_t i = 0; i < m_planes.size(); i++)
+        if (!func(i))
+          return false;
+      return true;
+    }
+
+    std::vector<std::stringstream> buffers(m_planes.size());
+    for (size_t i = 0; i < m_planes.size(); i++)
+      if (this->onScreen(i))
+        m_planes[i]->getProcessAdm().cout.setStream(buffers[i]);
+
+    std::vector<char> ok(m_planes.size(),true);
+#pragma omp parallel for schedule(dynamic) num_threads(plane_threads)
+    for (size_t i = 0; i < m_planes.size(); i++)
+      ok[i] = func(i);
+
+    // Write the buffered output in plane order
+    bool allOK = true;
+    for (size_t i = 0; i < m_planes.size(); i++)
+    {
+      if (this->onScreen(i))
+      {
+        m_planes[i]->getProcessAdm().cout.setStream(std::cout);
+        std::cout << buffers[i].str();
+      }
+      allOK &= ok[i] != 0;
+    }
+    std::cout.flush();
+
+    return allOK;
+  }
+
   std::vector<PlaneSolver*> m_planes; //!< Planar solvers
 
 private:
@@ -378,6 +486,7 @@ private:
   size_t planes;               //!< Total number of planes
   size_t procs_per_plane;      //!< Number of processes per plane
   int    output_plane;         //!< Plane to print to screen for (-1 for all)
+  int    plane_threads;        //!< Number of planes to solve concurrently
   char   direction;            //!< (Unoriented) normal direction of plane
   std::string log_files;       //!< Log file prefix for planes
   std::vector<int> planeNodes; //!< FSI nodes for all planes
@@ -15,16 +15,34 @@
 
 #include "VTF.h"
 #include <string>
+#include <vector>
 #include <map>
 
 
 /*!
   \brief Basic VTU file writer class.
+  \details The data arrays are written either as ascii text, or as raw binary
+  (optionally zlib-compressed) appended data. The patches are written either
+  as pieces of a single .vtu file, or as separate .vtu files tied together by
+  a .pvtu file. Unless a single time step is written, a .pvd collection file
+  referring to all time steps is written as well.
 */
 
 class VTU : public VTF {
   public:
-    VTU(const char* base, bool single);
+    //! \brief Output format of the data arrays.
+    enum Format {
+      ASCII  = 0, //!< Inline ascii text
+      BINARY = 1, //!< Raw binary appended data
+      ZLIB   = 2  //!< Zlib-compressed binary appended data
+    };
+
+    //! \brief The constructor initializes the file base name and format.
+    //! \param[in] base Output file name, the extension is stripped off
+    //! \param[in] single If \e true, a single time step is written
+    //! \param[in] format Output format of the data arrays
+    //! \param[in] pieces If \e true, write one .vtu file per patch
+    VTU(const char* base, bool single, int format = BINARY, bool pieces = false);
     virtual ~VTU();
 
     void clearGeometryBlocks();
@@ -64,6 +82,25 @@ class VTU : public VTF {
                       int idBlock = 1, const char* resultName = 0,
                       int iStep = 0, int iBlock = 1);
   protected:
+    //! \brief Writes the data arrays of a patch as a VTU piece.
+    //! \param file The stream to write the XML-elements to
+    //! \param app Appended binary data of the file
+    //! \param[in] patch 0-based index of the patch to write
+    //! \return \e false if the data arrays could not be encoded
+    bool writePiece(std::ostream& file, std::string& app, size_t patch) const;
+
+    //! \brief Writes the VTKFile header element.
+    void writeHeader(std::ostream& file, const char* type) const;
+    //! \brief Writes the appended data and the VTKFile closing element.
+    void writeFooter(std::ostream& file,
+                     const std::vector<std::string>& app) const;
+
+    //! \brief Writes a parallel .pvtu file referring to the patch files.
+    bool writePVTU(const std::string& name,
+                   const std::vector<std::string>& pieces) const;
+    //! \brief Writes the .pvd collection file for all written time steps.
+    bool writePVD() const;
+
     std::string m_base;
     std::vector<const ElementBlock*> m_geom;
     struct FieldInfo {
@@ -75,4 +112,9 @@ class VTU : public VTF {
     };
     std::map<int,FieldInfo> m_field;
     bool m_single;
+    int  m_format; //!< Output format of the data arrays
+    bool m_pieces; //!< If \e true, write one .vtu file per patch
+
+    //! \brief Time values and file names of the written time steps
+    std::vector< std::pair<Real,std::string> > m_steps;
 };
@@ -166,6 +166,9 @@ IF(IFEM_USE_HDF5)
                          ${HDF5_INCLUDE_DIRS})
     SET(IFEM_BUILD_CXX_FLAGS "${IFEM_BUILD_CXX_FLAGS} -DHAS_HDF5=1")
     list(APPEND IFEM_DEFINITIONS -DHAS_HDF5)
+    # Asynchronous output uses a background writer thread
+    FIND_PACKAGE(Threads REQUIRED)
+    SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${CMAKE_THREAD_LIBS_INIT})
   endif()
 ENDIF(IFEM_USE_HDF5)
 
@@ -212,6 +215,10 @@ IF(IFEM_USE_OPENMP)
   ENDIF(OPENMP_FOUND)
 ENDIF(IFEM_USE_OPENMP)
 
+# Lazily built search structures use std::call_once
+FIND_PACKAGE(Threads REQUIRED)
+list(APPEND IFEM_DEPLIBS ${CMAKE_THREAD_LIBS_INIT})
+
 # ISTL
 if(IFEM_USE_ISTL)
   find_package(ISTL)
@@ -20,6 +20,10 @@
 
 class ASMbase;
 
+namespace Go {
+  class SplineVolume;
+}
+
 
 /*!
   \brief Abstract interface for 3D spline patches.
@@ -62,6 +66,12 @@ public:
   //! loads, etc.) are however not copied.
   ASMbase* clone(const CharVec& nf = CharVec()) const;
 
+  //! \brief Assigns the spline geometry of this patch from a spline volume.
+  //! \details This is an in-memory alternative to ASMbase::read, to be used
+  //! by model generators, such that the spline data does not need to be
+  //! converted to text and parsed back again.
+  virtual bool assignSpline(const Go::SplineVolume& spline) = 0;
+
   //! \brief Checks that the patch is modelled in a right-hand-side system.
   virtual bool checkRightHandSystem() = 0;
 
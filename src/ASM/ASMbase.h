@@ -416,6 +416,25 @@ public:
   //! \return Local node number within the patch that matches the point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const = 0;
 
+  //! \brief Returns the parameter domain of an element.
+  //! \param[in] iel 1-based element index
+  //! \param[out] umin Lower parameter bounds of the element
+  //! \param[out] umax Upper parameter bounds of the element
+  //! \return \e false if not available for this patch type
+  virtual bool getElementDomain(int iel, double* umin, double* umax) const
+  { return false; }
+
+  //! \brief Evaluates the geometry and its derivatives at a specified point.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Parametric derivatives of the coordinates (nsd x ndim)
+  //! \return \e false if not available for this patch type
+  //!
+  //! \details This method, together with getElementDomain, is used by the
+  //! PointLocator to find the parameters of spatial points.
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const
+  { return false; }
+
   //! \brief Creates a standard FE model of this patch for visualization.
   //! \param[out] grid The generated finite element grid
   //! \param[in] npe Number of visualization nodes over each knot span
@@ -456,6 +475,18 @@ public:
                             const RealArray* gpar, bool regular = true,
                             int deriv = 0) const;
 
+  //! \brief Evaluates the basis functions at a specified point.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] ip 0-based local indices of the non-zero basis functions
+  //! \param[out] N Values of the non-zero basis functions
+  //! \return \e false if not available for this patch type
+  //!
+  //! \details The primary solution at the point is the sum of the nodal
+  //! values of \a ip weighted by \a N, as evaluated by evalSolution().
+  //! This is used to cache the basis function values at fixed points.
+  virtual bool evalBasis(const double* param, IntVec& ip, RealArray& N) const
+  { return false; }
+
   //! \brief Evaluates and interpolates a field over a given geometry.
   //! \param[in] basis The basis of the field to evaluate
   //! \param[in] locVec The coefficients of the field to evaluate
@@ -645,10 +676,12 @@ public:
   bool isFixed(int node, int dof, bool all = false) const;
 
 private:
-  //! \brief Recursive method used by \a resolveMPCchains.
-  //! \param[in] allMPCs All multi-point constraint equations in the model
-  //! \param mpc Pointer to the multi-point constraint equation to resolve
-  static bool resolveMPCchain(const MPCSet& allMPCs, MPC* mpc);
+  //! \brief Resolves one MPC equation, used by \a resolveMPCchains.
+  //! \param[in] mpcs Sorted array of all MPC equations in the model
+  //! \param[in] level Dependency level of each MPC equation
+  //! \param[in] imc 0-based index of the MPC equation to resolve
+  static bool resolveMPCchain(const std::vector<MPC*>& mpcs,
+                              const IntVec& level, int imc);
 
 protected:
   //! \brief Collapses the given two nodes into one.
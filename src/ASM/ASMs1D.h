@@ -191,6 +191,18 @@ public:
   //! \return 0 if no node (control point) matches this point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const;
 
+  //! \brief Returns the parameter domain of an element.
+  //! \param[in] iel 1-based element index
+  //! \param[out] umin Lower parameter bound of the element
+  //! \param[out] umax Upper parameter bound of the element
+  virtual bool getElementDomain(int iel, double* umin, double* umax) const;
+
+  //! \brief Evaluates the geometry and its derivatives at a specified point.
+  //! \param[in] param The u parameter of the point in knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Parametric derivatives of the coordinates
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
+
   //! \brief Creates a line element model of this patch for visualization.
   //! \param[out] grid The generated line grid
   //! \param[in] npe Number of visualization nodes over each knot span
@@ -213,6 +225,12 @@ public:
                             const RealArray* gpar, bool = true,
                             int deriv = 0) const;
 
+  //! \brief Evaluates the basis functions at a specified point.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] ip 0-based local indices of the non-zero basis functions
+  //! \param[out] N Values of the non-zero basis functions
+  virtual bool evalBasis(const double* param, IntVec& ip, RealArray& N) const;
+
   //! \brief Evaluates and interpolates a function over a given geometry.
   //! \param[in] func The function to evaluate
   //! \param[out] vec The obtained coefficients after interpolation
@@ -23,6 +23,10 @@ namespace Go {
   class SplineSurface;
 }
 
+namespace Immersed {
+  class QuadPoints;
+}
+
 
 /*!
   \brief Driver for assembly of structured 2D spline FE models.
@@ -125,6 +129,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates an instance from the given spline surface.
+  virtual bool assignSpline(const Go::SplineSurface& spline);
   //! \brief Writes the geometry of the SplineSurface object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
@@ -325,7 +331,7 @@ protected:
   //! \param[in] time Parameters for nonlinear/time-dependent simulations
   //! \param[in] itgPts Parameters and weights of the integration points
   bool integrate(Integrand& integrand, GlobalIntegral& glbInt,
-                 const TimeDomain& time, const Real3DMat& itgPts);
+                 const TimeDomain& time, const Immersed::QuadPoints& itgPts);
 
   //! \brief Evaluates an integral over element interfaces in the patch.
   //! \param integrand Object with problem-specific data and methods
@@ -348,6 +354,18 @@ public:
   //! \return 0 if no node (control point) matches this point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const;
 
+  //! \brief Returns the parameter domain of an element.
+  //! \param[in] iel 1-based element index
+  //! \param[out] umin Lower parameter bounds of the element
+  //! \param[out] umax Upper parameter bounds of the element
+  virtual bool getElementDomain(int iel, double* umin, double* umax) const;
+
+  //! \brief Evaluates the geometry and its derivatives at a specified point.
+  //! \param[in] param The (u,v) parameters of the point in knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Parametric derivatives of the coordinates
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
+
   //! \brief Calculates parameter values for visualization nodal points.
   //! \param[out] prm Parameter values in given direction for all points
   //! \param[in] dir Parameter direction (0,1)
@@ -383,6 +401,12 @@ public:
                             const RealArray* gpar, bool regular = true,
                             int deriv = 0) const;
 
+  //! \brief Evaluates the basis functions at a specified point.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] ip 0-based local indices of the non-zero basis functions
+  //! \param[out] N Values of the non-zero basis functions
+  virtual bool evalBasis(const double* param, IntVec& ip, RealArray& N) const;
+
   //! \brief Evaluates and interpolates a field over a given geometry.
   //! \param[in] basis The basis of the field to evaluate
   //! \param[in] locVec The coefficients of the field to evaluate
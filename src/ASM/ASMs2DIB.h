@@ -15,8 +15,7 @@
 #define _ASM_S2D_IB_H
 
 #include "ASMs2D.h"
-
-namespace Immersed { class Geometry; }
+#include "ImmersedBoundaries.h"
 
 
 /*!
@@ -103,8 +102,8 @@ private:
   Immersed::Geometry* myGeometry; //!< The physical geometry description
   ElementBlock*       myLines;    //!< Sub-cell grid lines (for plotting)
 
-  Real3DMat quadPoints; //!< The Gauss quadrature points for this patch
-  int       maxDepth;   //!< Maximum depth up to which to refine each element
+  Immersed::QuadPoints quadPoints; //!< The quadrature points for this patch
+  int                  maxDepth;   //!< Maximum refinement depth of elements
 };
 
 #endif
@@ -115,6 +115,12 @@ public:
   //! \return Local node number within the patch that is closest to the point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const;
 
+  //! \brief Returns \e false, since the elements are not knot-spans.
+  virtual bool getElementDomain(int, double*, double*) const { return false; }
+  //! \brief Returns \e false, since the elements are not knot-spans.
+  virtual bool evalGeometry(const double*, Vec3&, Matrix&) const
+  { return false; }
+
   //! \brief Creates a hexahedron element model of this patch for visualization.
   //! \param[out] grid The generated hexahedron grid
   //! \param[in] npe Number of visualization nodes over each knot span
@@ -140,6 +146,10 @@ public:
                             const RealArray* gpar, bool regular = true,
                             int = 0) const;
 
+  //! \brief Returns \e false, since point results are taken at the nodes.
+  virtual bool evalBasis(const double*, IntVec&, RealArray&) const
+  { return false; }
+
   //! \brief Evaluates the secondary solution field at all visualization points.
   //! \details The number of visualization points is the same as the order of
   //! the Lagrange elements by default.
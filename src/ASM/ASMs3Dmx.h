@@ -159,6 +159,10 @@ public:
                             const RealArray* gpar, bool regular = true,
                             int deriv = 0) const;
 
+  //! \brief Returns \e false, since the solution has several bases.
+  virtual bool evalBasis(const double*, IntVec&, RealArray&) const
+  { return false; }
+
   //! \brief Evaluates the secondary solution field at the given points.
   //! \param[out] sField Solution field
   //! \param[in] integrand Object with problem-specific data and methods
@@ -44,6 +44,35 @@ public:
     int thick;  //!< Thickness of connection.
   };
 
+  //! \brief Struct with the computational load estimate of a patch.
+  struct PatchLoad {
+    int nel[3];   //!< Number of knot-spans in each parameter direction
+    int order[3]; //!< Polynomial order (degree + 1) in each parameter direction
+    int ndof;     //!< Number of degrees of freedom in the patch
+
+    //! \brief Default constructor.
+    PatchLoad() : nel{0,0,0}, order{0,0,0}, ndof(0) {}
+
+    //! \brief Returns the number of parameter dimensions of the patch.
+    int getNoParamDim() const { return nel[2] > 0 ? 3 : (nel[1] > 0 ? 2 : 1); }
+    //! \brief Returns the number of control points in given direction.
+    int getSize(int d) const { return nel[d] > 0 ? nel[d]+order[d]-1 : 1; }
+    //! \brief Returns the estimated assembly and solution cost of the patch.
+    //! \details The element matrix assembly scales as nel*nen^2, whereas the
+    //! linear solver cost scales with the number of DOFs times the bandwidth.
+    double weight() const;
+  };
+
+  //! \brief Struct with the result of an automatic patch partitioning.
+  struct Partition {
+    std::vector<int>    owner;  //!< Process owning each patch (0-based)
+    std::vector<double> load;   //!< Total estimated load on each process
+    double imbalance;           //!< Ratio of maximum to average process load
+    int    edgeCut;             //!< Number of control points on ghost interfaces
+    //! \brief Recommended sub-block split (g1,g2,g3) for oversized patches.
+    std::map<int,std::vector<int>> splits;
+  };
+
   //! \brief Functor to order ghost connections.
   class SlaveOrder {
     public:
@@ -81,6 +110,42 @@ public:
       const DomainDecomposition& dd;
   };
 
+  //! \brief Class with a persistent plan for data exchange on ghost interfaces.
+  //! \details The ghost connections are grouped per neighbouring process,
+  //! such that a single non-blocking message is sent to each neighbour,
+  //! instead of one blocking send per connection.
+  class GhostExchange {
+  public:
+    //! \brief Default constructor.
+    GhostExchange() : nIfc(0), sendTag(0), recvTag(0) {}
+
+    //! \brief Sets up the plan from the ghost connections.
+    //! \param[in] dd The domain decomposition with the ghost connections
+    //! \param[in] myPid Process id of this process
+    void init(const DomainDecomposition& dd, int myPid);
+
+    //! \brief Posts non-blocking sends of the data on master interfaces.
+    //! \param[in] adm Parallel process administrator
+    //! \param[in] data Data for each ghost connection, in set order.
+    //! Only the connections with a local master patch are sent.
+    void send(const ProcessAdm& adm, const std::vector<std::vector<int>>& data);
+    //! \brief Receives the data on slave interfaces.
+    //! \param[in] adm Parallel process administrator
+    //! \param[out] data Data for each ghost connection, in set order.
+    //! Only the connections with a local slave patch are received.
+    bool receive(const ProcessAdm& adm, std::vector<std::vector<int>>& data);
+    //! \brief Waits for completion of the posted sends.
+    void finish(const ProcessAdm& adm);
+
+  private:
+    std::map<int,std::vector<size_t>> sendTo;   //!< Connections to send to each process
+    std::map<int,std::vector<size_t>> recvFrom; //!< Connections to receive from each process
+    std::map<int,std::vector<int>>    sendBuf;  //!< Buffers of the posted sends
+    size_t nIfc;  //!< Total number of ghost connections
+    int sendTag;  //!< Number of sends posted, used as message tag
+    int recvTag;  //!< Number of receives done, used as message tag
+  };
+
   std::set<Interface, SlaveOrder> ghostConnections; //!< Connections to other processes.
 
   //! \brief Default constructor.
@@ -110,6 +175,24 @@ public:
   static std::vector<std::vector<int>> calcSubdomains(size_t nel1, size_t nel2, size_t nel3,
                                                       size_t g1, size_t g2, size_t g3, size_t overlap);
 
+  //! \brief Calculates a load-balanced distribution of patches on processes.
+  //! \param[in] loads Load estimate of each patch
+  //! \param[in] top Patch topology, with 1-based master and slave patches
+  //! \param[in] nProc Number of processes to distribute the patches on
+  //! \param[out] part The resulting partition with imbalance statistics
+  //! \param[in] tol Allowed load imbalance, relative to the average load
+  //! \details The patches are first ordered by a breadth-first traversal of
+  //! the patch graph, starting from a pseudo-peripheral patch, and the ordered
+  //! list is cut into contiguous chunks of roughly equal load. The partition
+  //! is then refined by moving boundary patches to neighbouring processes
+  //! when it reduces the interface size, without violating the imbalance
+  //! tolerance, or when it improves the balance.
+  //! Patches which alone exceed the load tolerance are reported with a
+  //! recommended tensor-product sub-block split in \a part.splits.
+  static bool calcPartition(const std::vector<PatchLoad>& loads,
+                            const std::vector<Interface>& top,
+                            int nProc, Partition& part, double tol = 0.05);
+
   //! \brief Get first equation owned by this process.
   int getMinEq(size_t idx = 0) const { return blocks[idx].minEq; }
   //! \brief Get last equation owned by this process.
@@ -157,6 +240,11 @@ public:
   size_t getNoBlocks() const { return blocks.size()-1; }
 
 private:
+  //! \brief Returns the number of control points on a patch interface.
+  //! \param[in] load Load estimate of the master patch of the interface
+  //! \param[in] ifc The patch interface
+  static int interfaceSize(const PatchLoad& load, const Interface& ifc);
+
   //! \brief Calculates a 1D partitioning with a given overlap.
   //! \param[in] nel1 Number of knot-spans in first parameter direction.
   //! \param[in] g1 Number of subdomains in first parameter direction.
@@ -220,6 +308,7 @@ private:
   bool sanityCheckCorners(const SIMbase& sim);
 
   std::map<int,int> patchOwner; //!< Process that owns a particular patch
+  GhostExchange ghostPlan; //!< Communication plan for the ghost connections
 
   //! \brief Struct with information per matrix block.
   struct BlockInfo {
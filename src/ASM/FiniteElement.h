@@ -119,4 +119,52 @@ private:
   std::vector<Matrix3D> d2NxdX2;
 };
 
+
+/*!
+  \brief Class representing a finite element at all its integration points.
+  \details The integration point quantities are stored in structure-of-arrays
+  layout, with one matrix column (or array entry) per integration point.
+  This allows the integrands to evaluate the element matrices as a few
+  matrix-matrix products, instead of one rank-1 update per point.
+*/
+
+class FiniteElementBatch
+{
+public:
+  //! \brief The constructor initializes the array sizes.
+  //! \param[in] n Number of basis functions
+  //! \param[in] nsd Number of spatial dimensions
+  FiniteElementBatch(size_t n = 0, size_t nsd = 3);
+
+  //! \brief Removes all integration points.
+  void clear();
+  //! \brief Appends an integration point to the batch.
+  //! \param[in] fe Finite element quantities at the integration point
+  //! \param[in] X Cartesian coordinates of the integration point
+  void append(const FiniteElement& fe, const Vec3& X);
+
+  //! \brief Returns the number of integration points.
+  size_t size() const { return detJxW.size(); }
+
+  //! \brief Scales each column of a matrix by the integration point weight.
+  //! \param[out] W Caller-owned matrix receiving the weighted values
+  //! \param[in] B Matrix with one column per integration point
+  //! \return A reference to \a W, for use as argument in matrix products
+  const Matrix& weighted(Matrix& W, const Matrix& B) const;
+
+  // Element quantities
+  int    iel; //!< Element identifier
+  size_t iGP; //!< Global counter of the first integration point
+
+  // Gauss point quantities
+  RealArray           detJxW; //!< Weighted determinant of coordinate mapping
+  Matrix              N;      //!< Basis function values, one column per point
+  std::vector<Matrix> dNdX;   //!< Basis function derivatives in each direction
+  std::vector<RealArray> X;   //!< Cartesian point coordinates in each direction
+
+  // Work arrays of the batched operators, reused for all elements
+  mutable Matrix Bw; //!< Weighted basis function values or derivatives
+  mutable Matrix Ae; //!< Element matrix of a single component
+};
+
 #endif
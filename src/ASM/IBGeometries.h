@@ -50,6 +50,9 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Writes a unique description of the geometry to a stream.
+  virtual bool writeSignature(std::ostream& os) const;
+
 protected:
   double R;  //!< Hole radius
   double Xc; //!< X-coordinate of hole center
@@ -75,6 +78,9 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Writes a unique description of the geometry to a stream.
+  virtual bool writeSignature(std::ostream& os) const;
+
 private:
   double X1; //!< X-coordinate of second circle center
   double Y1; //!< Y-coordinate of second circle center
@@ -108,6 +114,9 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Writes a unique description of the geometry to a stream.
+  virtual bool writeSignature(std::ostream& os) const;
+
 private:
   std::vector<Hole2D*> holes; //!< The holes that perforate the plate
 };
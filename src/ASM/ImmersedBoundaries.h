@@ -19,6 +19,8 @@
 #endif
 
 #include <vector>
+#include <string>
+#include <iostream>
 
 class ElementBlock;
 
@@ -51,6 +53,80 @@ namespace Immersed //! Utilities for immersed boundary calculations
 
     //! \brief Creates a finite element model of the geometry for visualization.
     virtual ElementBlock* tesselate() const { return 0; }
+
+    //! \brief Writes a unique description of the geometry to a stream.
+    //! \details The description is used as part of the key identifying cached
+    //! quadrature points. Geometries not overriding this method are never
+    //! cached.
+    virtual bool writeSignature(std::ostream&) const { return false; }
+  };
+
+
+  /*!
+    \brief Class containing the quadrature points of all elements in a patch.
+    \details The points are stored in a flat array, where each point occupies
+    \a nsd+1 consecutive entries (the \a nsd parameters and the weight).
+    An offset array holds the index of the first point of each element,
+    similar to a compressed row storage of the nested per-element arrays.
+  */
+
+  class QuadPoints
+  {
+  public:
+    //! \brief Default constructor.
+    explicit QuadPoints(unsigned char n = 2) : nsd(n), offset(1,0) {}
+
+    //! \brief Clears the point set and defines the number of elements.
+    void clear(size_t nel = 0, unsigned char n = 0);
+    //! \brief Assigns the points of an element.
+    //! \param[in] e 0-based element index
+    //! \param[in] pts Parameters and weights of the points, stored pointwise
+    //! \param[in] isCut If \e true, the element is intersected by the boundary
+    //! \details All elements must be assigned, in increasing order.
+    void setElement(size_t e, const RealArray& pts, bool isCut);
+
+    //! \brief Returns the number of elements.
+    size_t size() const { return offset.size()-1; }
+    //! \brief Returns the number of points in the element \a e.
+    size_t size(size_t e) const { return offset[e+1] - offset[e]; }
+    //! \brief Returns \e true if the element \a e has no points.
+    bool empty(size_t e) const { return offset[e+1] == offset[e]; }
+    //! \brief Returns the total number of points.
+    size_t noPoints() const { return offset.back(); }
+    //! \brief Returns the index of the first point in element \a e.
+    size_t first(size_t e) const { return offset[e]; }
+    //! \brief Returns the number of parameter dimensions.
+    unsigned char dim() const { return nsd; }
+
+    //! \brief Returns \e true if element \a e is intersected by the boundary.
+    bool isCut(size_t e) const { return cut[e]; }
+
+    //! \brief Returns a pointer to the parameters of point \a i in element \a e.
+    //! \details The weight of the point is at index \a nsd.
+    const double* operator()(size_t e, size_t i) const
+    { return &data[(offset[e]+i)*(nsd+1)]; }
+    //! \brief Returns a pointer to the parameters of point \a i in element \a e.
+    double* operator()(size_t e, size_t i)
+    { return &data[(offset[e]+i)*(nsd+1)]; }
+
+    //! \brief Replaces the points in each cut element by a fixed set of points.
+    //! \param[in] n Number of points in each parameter direction
+    //! \details The new points are the tensor-product Gauss points of the
+    //! element, with weights computed by moment fitting, such that the
+    //! compressed rule integrates the same polynomials of order \a n-1 in each
+    //! direction as the original sub-cell rule.
+    bool compress(int n);
+
+    //! \brief Writes the point set to a binary stream.
+    void write(std::ostream& os) const;
+    //! \brief Reads the point set from a binary stream.
+    bool read(std::istream& is);
+
+  private:
+    unsigned char       nsd;    //!< Number of parameter dimensions
+    std::vector<size_t> offset; //!< Index of the first point of each element
+    std::vector<char>   cut;    //!< Intersection flag of each element
+    RealArray           data;   //!< Point parameters and weights
   };
 
   //! \brief Returns the coordinates and weights for the quadrature points.
@@ -64,11 +140,8 @@ namespace Immersed //! Utilities for immersed boundary calculations
   //! \param[in] max_depth Maximum depth up to which you want to refine
   //! \param[in] p Order of the Gauss integration
   //! \param[out] quadPoints the quadrature point coordinates and weights;
-  //! first index is the element counter (0 to number of elements minus 1),
-  //! second index is the quadrature point counter for each element (0 to number
-  //! of quadrature points minus 1 for element identified by the first index),
-  //! third index is the coordinate/weight index (0=xi, 1=eta, 2=weight in 2D,
-  //! 0=xi, 1=eta, 2=zeta, 3=weight in 3D)
+  //! for each point the coordinates (xi,eta in 2D, xi,eta,zeta in 3D)
+  //! are followed by the weight
   //! \param grid Points to an \a ElementBlock plotting the added grid lines
   //!
   //! \details The element corner points are ordered according to a standard
@@ -78,10 +151,17 @@ namespace Immersed //! Utilities for immersed boundary calculations
   //! The coordinates returned are assumed to be referring to the bi-unit square
   //! (tri-unit cube in 3D) of each element, and the weights are standard Gauss
   //! quadrature weights, which summs to 2 in the power of number of dimensions.
+  //!
+  //! The elements are processed in parallel, unless grid lines are requested.
+  //! If \a cacheDir is set and the geometry provides a signature, the points
+  //! are read from a cache file instead, if one exists for this geometry,
+  //! element mesh and depth. Otherwise such a file is written after the
+  //! calculation. If \a momentFitting is positive, the cut elements are
+  //! compressed to \a momentFitting points in each direction.
   bool getQuadraturePoints(const Geometry& geo,
 			   const Real3DMat& elmCorner,
 			   int max_depth, int p,
-			   Real3DMat& quadPoints, ElementBlock* grid = 0);
+			   QuadPoints& quadPoints, ElementBlock* grid = 0);
 
   //! \brief Returns the quadrature points for a 2D element.
   bool getQuadraturePoints(const Geometry& geo,
@@ -116,6 +196,12 @@ namespace Immersed //! Utilities for immersed boundary calculations
   extern int stabilization; //!< Stabilization option
 
   extern bool plotCells; //!< Flags whether subcells should be plotted or not
+
+  //! \brief Number of points in each direction of the compressed quadrature
+  //! for cut elements (0 = no compression)
+  extern int momentFitting;
+
+  extern std::string cacheDir; //!< Directory for cached quadrature points
 }
 
 #endif
@@ -21,6 +21,7 @@ struct TimeDomain;
 class LocalIntegral;
 class FiniteElement;
 class MxFiniteElement;
+class FiniteElementBatch;
 class Vec3;
 
 
@@ -146,7 +147,8 @@ public:
     NODAL_ROTATIONS   = 64, //!< Integrand wants nodal rotation tensors
     XO_ELEMENTS      = 128, //!< Integrand is defined on extraordinary elements
     INTERFACE_TERMS  = 256, //!< Integrand has element interface terms
-    NORMAL_DERIVS    = 512  //!< Integrand p'th order normal derivatives
+    NORMAL_DERIVS    = 512, //!< Integrand p'th order normal derivatives
+    BATCHED_POINTS  = 1024  //!< Integrand evaluates all element points at once
   };
 
   //! \brief Defines which FE quantities are needed by the integrand.
@@ -184,6 +186,17 @@ public:
     return this->evalInt(elmInt,fe,X);
   }
 
+  //! \brief Evaluates the integrand at all interior points of an element.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Finite element data of all integration points of the element
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  //!
+  //! \details This method is invoked by the assembly drivers instead of
+  //! \a evalInt for integrands with the BATCHED_POINTS trait. Only the basis
+  //! functions and their first derivatives are available in \a fe.
+  virtual bool evalIntBatch(LocalIntegral&, const FiniteElementBatch&,
+                            const TimeDomain&) const { return false; }
+
   //! \brief Evaluates the integrand at an interior point.
   //! \param elmInt The local integral object to receive the contributions
   //! \param[in] fe Mixed finite element data of current integration point
@@ -30,6 +30,10 @@ namespace LR {
   class LRSplineSurface;
 }
 
+namespace Immersed {
+  class QuadPoints;
+}
+
 
 /*!
   \brief Driver for assembly of unstructured 2D spline FE models.
@@ -59,6 +63,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates an instance from the given spline surface.
+  virtual bool assignSpline(const Go::SplineSurface& spline);
   //! \brief Writes the geometry of the SplineSurface object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
@@ -252,7 +258,7 @@ protected:
   //! \param[in] time Parameters for nonlinear/time-dependent simulations
   //! \param[in] itgPts Parameters and weights of the integration points
   bool integrate(Integrand& integrand, GlobalIntegral& glbInt,
-                 const TimeDomain& time, const Real3DMat& itgPts);
+                 const TimeDomain& time, const Immersed::QuadPoints& itgPts);
 
 public:
 
@@ -267,6 +273,18 @@ public:
   //! \return 0 if no node (control point) matches this point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const;
 
+  //! \brief Returns the parameter domain of an element.
+  //! \param[in] iel 1-based element index
+  //! \param[out] umin Lower parameter bounds of the element
+  //! \param[out] umax Upper parameter bounds of the element
+  virtual bool getElementDomain(int iel, double* umin, double* umax) const;
+
+  //! \brief Evaluates the geometry and its derivatives at a specified point.
+  //! \param[in] param The (u,v) parameters of the point in knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Parametric derivatives of the coordinates
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
+
   //! \brief Calculates parameter values for visualization nodal points.
   //! \param[out] prm Parameter values in given direction for all points
   //! \param[in] dir Parameter direction (0,1)
@@ -302,6 +320,12 @@ public:
                             const RealArray* gpar, bool regular = false,
                             int deriv = 0) const;
 
+  //! \brief Evaluates the basis functions at a specified point.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] ip 0-based local indices of the non-zero basis functions
+  //! \param[out] N Values of the non-zero basis functions
+  virtual bool evalBasis(const double* param, IntVec& ip, RealArray& N) const;
+
   //! \brief Evaluates the secondary solution field at all visualization points.
   //! \param[out] sField Solution field
   //! \param[in] integrand Object with problem-specific data and methods
@@ -15,8 +15,7 @@
 #define _ASM_U2D_IB_H
 
 #include "ASMu2D.h"
-
-namespace Immersed { class Geometry; }
+#include "ImmersedBoundaries.h"
 
 
 /*!
@@ -74,8 +73,8 @@ public:
 private:
   Immersed::Geometry* myGeometry; //!< The physical geometry description
 
-  Real3DMat quadPoints; //!< The Gauss quadrature points for this patch
-  int       maxDepth;   //!< Maximum depth up to which to refine each element
+  Immersed::QuadPoints quadPoints; //!< The quadrature points for this patch
+  int                  maxDepth;   //!< Maximum refinement depth of elements
 };
 
 #endif
@@ -52,6 +52,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates an instance from the given spline volume.
+  virtual bool assignSpline(const Go::SplineVolume& spline);
   //! \brief Writes the geometry of the SplineVolume object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
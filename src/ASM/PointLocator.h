@@ -0,0 +1,159 @@
+// $Id$
+//==============================================================================
+//!
+//! \file PointLocator.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author SINTEF Digital
+//!
+//! \brief Spatial search for points and nodes in a multi-patch model.
+//!
+//==============================================================================
+
+#ifndef _POINT_LOCATOR_H
+#define _POINT_LOCATOR_H
+
+#include "Vec3.h"
+#include <vector>
+#include <cstddef>
+
+class ASMbase;
+
+
+/*!
+  \brief Class for locating spatial points in a multi-patch model.
+
+  \details The locator builds a bounding-volume hierarchy (BVH) over the
+  bounding boxes of the patches, and one over the element bounding boxes
+  within each patch. The element boxes are the boxes of the element control
+  points, which contain the element due to the convex hull property.
+  A physical point is then located by Newton iterations for the parameters,
+  in the elements whose boxes contain the point only.
+
+  A separate BVH over the nodal points is used for closest-node queries.
+
+  The patches must implement ASMbase::getElementDomain and
+  ASMbase::evalGeometry to be searched for points, other patches are only
+  included in the closest-node queries. The locator is read-only once built,
+  and can be used from several threads concurrently.
+*/
+
+class PointLocator
+{
+public:
+  //! \brief The constructor builds the search trees.
+  //! \param[in] model The patches to search in
+  explicit PointLocator(const std::vector<ASMbase*>& model);
+  //! \brief Constructor for searching in a single patch.
+  //! \param[in] patch The patch to search in
+  explicit PointLocator(const ASMbase* patch);
+
+  //! \brief Result of a point search.
+  struct Point
+  {
+    size_t patch;   //!< 0-based index of the patch containing the point
+    int    iel;     //!< 1-based element index within the patch
+    double u[3];    //!< Parameters of the point
+    Vec3   X;       //!< Spatial coordinates of the found point
+    double dist;    //!< Distance from the searched point to \a X
+  };
+
+  //! \brief Finds the patch and parameters of a spatial point.
+  //! \param[in] X Spatial coordinates of the point
+  //! \param[out] pt The located point
+  //! \return \e false if no element bounding box contains the point
+  //!
+  //! \details If the point is outside the model, but inside an element box,
+  //! the closest point found in these elements is returned.
+  bool findPoint(const Vec3& X, Point& pt) const;
+
+  //! \brief Finds the node that is closest to a spatial point.
+  //! \param[in] X Spatial coordinates of the point
+  //! \param[out] dist Distance from \a X to the closest node
+  //! \return 0-based patch index and 1-based local node number of the node,
+  //! the node number is zero if the model has no nodes
+  std::pair<size_t,size_t> findClosestNode(const Vec3& X, double& dist) const;
+
+  //! \brief Returns the geometric tolerance of the point searches.
+  double getTolerance() const { return tol; }
+
+private:
+  //! \brief Builds the search trees over the patches.
+  void build();
+
+  //! \brief An axis-aligned bounding box.
+  struct Box
+  {
+    double min[3]; //!< Lower corner
+    double max[3]; //!< Upper corner
+
+    //! \brief Default constructor creating an empty box.
+    Box();
+    //! \brief Extends the box to include a point.
+    void extend(const Vec3& X);
+    //! \brief Extends the box to include another box.
+    void extend(const Box& b);
+    //! \brief Returns the squared distance from a point to the box.
+    double dist2(const Vec3& X) const;
+  };
+
+  //! \brief A static bounding-volume hierarchy over a set of boxes.
+  class Tree
+  {
+  public:
+    //! \brief Builds the tree.
+    //! \param[in] boxes Bounding boxes of the items to store
+    void build(const std::vector<Box>& boxes);
+    //! \brief Returns the items whose boxes are within a distance of a point.
+    //! \param[in] X Spatial coordinates of the point
+    //! \param[in] eps Distance tolerance
+    //! \param[out] items Indices of the found items
+    void find(const Vec3& X, double eps, std::vector<int>& items) const;
+    //! \brief Returns the item that is closest to a point.
+    //! \param[in] X Spatial coordinates of the point
+    //! \param[in] points Point coordinates of each item
+    //! \param[out] dist2 Squared distance to the closest item
+    int closest(const Vec3& X, const std::vector<Vec3>& points,
+                double& dist2) const;
+    //! \brief Returns the bounding box of the whole tree.
+    Box bounds() const { return nodes.empty() ? Box() : nodes.front().box; }
+
+  private:
+    //! \brief Recursively builds a sub-tree.
+    int build(const std::vector<Box>& boxes, int first, int last);
+
+    //! \brief A tree node.
+    struct Node
+    {
+      Box box;   //!< Bounding box of the sub-tree
+      int first; //!< Index of the first item (leaf nodes only)
+      int count; //!< Number of items in leaf nodes, zero for inner nodes
+      int right; //!< Index of the right child (the left is the next node)
+    };
+
+    std::vector<Node> nodes; //!< The tree nodes in depth-first order
+    std::vector<int>  items; //!< Item indices of the leaf nodes
+  };
+
+  //! \brief Newton iterations for the parameters of a point in an element.
+  //! \param[in] pch The patch containing the element
+  //! \param[in] iel 1-based element index
+  //! \param[in] X Spatial coordinates of the point
+  //! \param pt The located point, updated if closer than before
+  void invert(const ASMbase* pch, int iel, const Vec3& X, Point& pt) const;
+
+  std::vector<const ASMbase*> patches; //!< The patches of the model
+
+  Tree              patchTree; //!< BVH over the patch bounding boxes
+  std::vector<Tree> elmTrees;  //!< BVH over the elements of each patch
+  std::vector<std::vector<int>> elms; //!< Element indices in each patch
+
+  Tree                nodeTree; //!< BVH over all nodal points
+  std::vector<Vec3>   nodeX;    //!< Coordinates of all nodal points
+  std::vector<std::pair<size_t,size_t>> nodes; //!< Patch and node indices
+
+  double tol; //!< Geometric tolerance, relative to the model size
+};
+
+#endif
@@ -116,6 +116,8 @@ private:
   };
   mutable std::map<char, DofIS> dofIS; //!< Map of dof type scatter info
   mutable IS glob2LocEq = nullptr; //!< Index set for global-to-local equations.
+  mutable VecScatter glob2LocCtx = nullptr; //!< Global-to-local equation scatter
+  mutable Vec glob2LocSol; //!< Local solution vector for the scatter
 };
 
 #endif
@@ -15,8 +15,11 @@
 #define _SPLINE_FIELD_3D_H
 
 #include "FieldBase.h"
+#include <memory>
+#include <mutex>
 
 class ASMs3D;
+class PointLocator;
 
 namespace Go {
   class SplineVolume;
@@ -40,8 +43,8 @@ public:
   //! \param[in] name Name of spline field
   SplineField3D(const ASMs3D* patch, const RealArray& v,
                 char basis = 1, const char* name = nullptr);
-  //! \brief Empty destructor.
-  virtual ~SplineField3D() {}
+  //! \brief The destructor frees the point search structure.
+  virtual ~SplineField3D();
 
   // Methods to evaluate the field
   //==============================
@@ -56,6 +59,12 @@ public:
 
   //! \brief Computes the value at a given global coordinate.
   //! \param[in] x Global/physical coordinate for point
+  //!
+  //! \details The point is located by a bounding box search over the
+  //! elements of the patch, followed by Newton iterations in the candidate
+  //! elements. The search structure is built once, on the first invocation.
+  //! Only points outside all element boxes are projected onto the geometry
+  //! by GoTools, which is serialized between threads.
   virtual double valueCoor(const Vec3& x) const;
 
   //! \brief Computes the value at a grid of visualization points.
@@ -81,6 +90,10 @@ public:
 protected:
   const Go::SplineVolume* basis; //!< Spline basis description
   const Go::SplineVolume* vol;   //!< Spline geometry description
+
+  const ASMs3D* patch; //!< The patch on which the field is defined
+  mutable std::unique_ptr<PointLocator> locator; //!< Element search structure
+  mutable std::once_flag locatorBuilt; //!< Guards the creation of \a locator
 };
 
 #endif
@@ -125,6 +125,10 @@ public:
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool, Real* rc = nullptr);
+  //! \brief Solves the linear system of equations for multiple right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  virtual bool solve(const std::vector<SystemVector*>& B, Real* rc = nullptr);
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side matrix on input, solution matrix on output
   bool solve(Matrix& B);
@@ -37,6 +37,7 @@ class ProcessAdm
 
 #if defined(HAS_PETSC) || defined(HAVE_MPI)
   MPI_Comm comm;   //!< MPI communicator
+  mutable std::vector<MPI_Request> pending; //!< Pending non-blocking sends
 #endif
 
 public:
@@ -114,6 +115,24 @@ public:
   //! \param[in]  source Process id for source
   void receive(std::vector<double>& rvec, int source) const;
 
+  //! \brief Non-blocking send of an integer vector.
+  //! \param[in] ivec Vector to be sent, must be kept alive until waitAll()
+  //! \param[in] dest Process id for destination
+  //! \param[in] tag Message tag
+  void isend(const std::vector<int>& ivec, int dest, int tag) const;
+  //! \brief Blocking receive of an integer vector of unknown size.
+  //! \param[out] ivec Integer vector to receive
+  //! \param[in] tag Message tag
+  //! \return Process id of the source, the first to arrive is received
+  int receiveAny(std::vector<int>& ivec, int tag) const;
+  //! \brief Waits for completion of all pending non-blocking sends.
+  void waitAll() const;
+
+  //! \brief Exclusive prefix sum of an integer value over the processes.
+  //! \param[in] value Integer to be summed
+  //! \return Sum of \a value over all processes with lower id
+  int exScan(int value) const;
+
   //! \brief AllReduce for integer value.
   //! \param[in] value Integer to be reduced
   //! \param[in] oper MPI operator (MPI_MIN, MPI_MAX, MPI_SUM, MPI_PROD, etc.)
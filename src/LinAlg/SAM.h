@@ -80,6 +80,21 @@ public:
   //! \brief Finds the set of free DOFs coupled to each free DOF.
   bool getDofCouplings(std::vector<IntSet>& dofc) const;
 
+  //! \brief Computes the bandwidth and profile of the system matrix.
+  //! \param[out] bandw Maximum distance from the diagonal of a non-zero term
+  //! \param[out] profile Number of terms within the lower envelope
+  bool getBandwidth(int& bandw, size_t& profile) const;
+
+  //! \brief Renumbers the system equations to reduce bandwidth or fill-in.
+  //! \param[in] method Renumbering method (1=RCM, 2=nested dissection)
+  //!
+  //! \details The equations of each DOF status group (1 and 2) are renumbered
+  //! separately, such that the group 1 equations still come first.
+  //! Only the \a MEQN array is changed, thus this method must be invoked
+  //! before any system matrices are allocated. The sparsity pattern and the
+  //! solution expansion then follow the new numbering automatically.
+  bool renumberEquations(int method);
+
   //! \brief Initializes the system matrices prior to the element assembly.
   //! \param sysK   The system left-hand-side matrix to be initialized
   //! \param sysRHS The system right-hand-side load vector to be initialized
@@ -238,6 +253,20 @@ public:
   //! \details This version is typically used to expand eigenvectors.
   bool expandVector(const Vector& solVec, Vector& dofVec) const;
 
+  //! \brief Extracts the free DOFs of a vector into equation-ordering.
+  //! \param[in] dofVec Degrees of freedom vector, length = NDOF
+  //! \param[out] solVec Vector in equation-ordering, length = NEQ
+  //! \return \e false if the length of \a dofVec is invalid, otherwise \e true
+  //!
+  //! \details This is the inverse of expandVector() for the free DOFs.
+  //! The values of constrained (slave) DOFs are ignored.
+  bool restrictVector(const Vector& dofVec, Vector& solVec) const;
+
+  //! \brief Checks whether any constraint equation has a non-zero constant.
+  //! \details This is the case when there are non-homogenous Dirichlet BCs
+  //! with a non-zero value (or increment) at the current time.
+  bool hasInhomogeneousConstraints() const;
+
   //! \brief Applies the non-homogenous Dirichlet BCs to the given vector.
   //! \param dofVec Degrees of freedom vector, length = NDOF
   //!
@@ -89,6 +89,9 @@ public:
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   virtual bool solve(SystemVector& B, bool, Real*);
+  //! \brief Solves the linear system of equations for multiple right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  virtual bool solve(const std::vector<SystemVector*>& B, Real*);
 
   //! \brief Solves a generalized symmetric-definite eigenproblem.
   //! \details The eigenproblem is assumed to be on the form
@@ -109,6 +112,11 @@ public:
   virtual Real Linfnorm() const;
 
 private:
+  //! \brief Invokes the SPR equation solver for a block of right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] nrhs Number of right-hand-side vectors stored column-wise in B
+  bool solve(Real* B, size_t nrhs);
+
   int mpar[NS]; //!< Matrix of sparse PARameters
   int* msica;   //!< Matrix of Storage Information for CA
   int* msifa;   //!< Matrix of Storage Information for FA
@@ -204,6 +204,12 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool newLHS = true, Real* rc = nullptr);
+  //! \brief Solves the linear system of equations for multiple right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  //!
+  //! \details With SuperLU, all right-hand-sides are solved in one call.
+  virtual bool solve(const std::vector<SystemVector*>& B, Real* rc = nullptr);
 
 protected:
   //! \brief Converts the matrix to an optimized row-oriented format.
@@ -243,6 +249,11 @@ protected:
 
 public:
   static bool printSLUstat; //!< Print solution statistics for SuperLU?
+  //! \brief Re-use the row permutation when refactoring with SuperLU?
+  //! \details The column ordering is always re-used as long as the sparsity
+  //! pattern is unchanged. Re-using also the row permutation saves the partial
+  //! pivoting, but is safe only when the matrix values change moderately.
+  static bool reuseSLUrowPerm;
 
 private:
   //! Flag for the editability of the matrix elements:
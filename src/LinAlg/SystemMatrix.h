@@ -311,6 +311,15 @@ public:
     return this->solve(x.copy(b),newLHS);
   }
 
+  //! \brief Solves the linear system of equations for multiple right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  //!
+  //! \details This default implementation solves for one right-hand-side at
+  //! the time, re-using the factorization or preconditioner of the first one.
+  //! Direct solvers override it to solve for all of them as one dense block.
+  virtual bool solve(const std::vector<SystemVector*>& B, Real* rc = nullptr);
+
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const = 0;
 
@@ -327,6 +336,20 @@ protected:
   //! \brief Writes the system matrix to the given output stream.
   virtual std::ostream& write(std::ostream& os) const { return os; }
 
+  //! \brief Copies a set of vectors into a column-wise dense block.
+  //! \param[in] B The vectors to copy, must all be of type STD and length \a n
+  //! \param[in] n Length of each vector
+  //! \param[out] X Column-wise dense block of the vectors
+  //! \return \e false if some of the vectors can not be blocked
+  static bool gatherColumns(const std::vector<SystemVector*>& B, size_t n,
+                            Vector& X);
+  //! \brief Copies a column-wise dense block back into a set of vectors.
+  //! \param[in] X Column-wise dense block
+  //! \param[in] n Length of each vector
+  //! \param[out] B The vectors to receive the columns of \a X
+  static void scatterColumns(const Vector& X, size_t n,
+                             const std::vector<SystemVector*>& B);
+
   //! \brief Global stream operator printing the matrix contents.
   friend std::ostream& operator<<(std::ostream& os, const SystemMatrix& A)
   {
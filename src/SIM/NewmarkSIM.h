@@ -16,6 +16,8 @@
 
 #include "MultiStepSIM.h"
 
+class SystemMatrix;
+
 
 /*!
   \brief Newmark-based solution driver for dynamic isogeometric FEM simulators.
@@ -26,8 +28,8 @@ class NewmarkSIM : public MultiStepSIM
 public:
   //! \brief The constructor initializes default solution parameters.
   NewmarkSIM(SIMbase& sim);
-  //! \brief Empty destructor.
-  virtual ~NewmarkSIM() {}
+  //! \brief The destructor frees the global mass and stiffness matrices.
+  virtual ~NewmarkSIM();
 
   using MultiStepSIM::parse;
   //! \brief Parses a data section from an XML document.
@@ -74,6 +76,19 @@ protected:
   //! \brief Finalizes the right-hand-side vector on the system level.
   virtual void finalizeRHSvector(bool) {}
 
+  //! \brief Checks whether the constant-matrix solution path can be used.
+  bool useConstantMatrices();
+  //! \brief Assembles the global mass and stiffness matrices.
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  bool assembleConstantMatrices(const TimeDomain& time);
+  //! \brief Computes the right-hand-side vector from the global matrices.
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  //!
+  //! \details The external forces are assembled with zero solution vectors,
+  //! and the inertia, damping and elastic forces of the predicted solution
+  //! are then subtracted using matrix-vector products with \b M and \b K.
+  bool assembleConstantRHS(const TimeDomain& time);
+
 public:
   //! \brief Returns a const reference to current velocity vector.
   const Vector& getVelocity() const { return solution[solution.size()-2]; }
@@ -107,6 +122,18 @@ protected:
   double divgLim;   //!< Relative divergence limit
   unsigned short int cNorm; //!< Option for which convergence norm to use
 
+  // Convergence check state, kept per solver such that several solvers
+  // may iterate concurrently
+  double convTol;   //!< Convergence tolerance of the current step
+  double prevNorm;  //!< Scaled norm of the previous iteration
+  int    nIncrease; //!< Number of iterations with increasing norm
+
+  // Constant-matrix solution path for linear problems
+  bool   linearSys; //!< If \e true, the mass and stiffness are constant
+  double linDt;     //!< Time step size of the factorized Newton matrix
+  SystemMatrix* linM; //!< Global mass matrix
+  SystemMatrix* linK; //!< Global stiffness matrix
+
 public:
   static const char* inputContext; //!< Input file context for solver parameters
 };
@@ -111,6 +111,12 @@ protected:
   int    nupdat;  //!< Number of iterations with updated tangent
   int    prnSlow; //!< How many DOFs to print out on slow convergence
 
+  // Convergence check state, kept per solver such that several solvers
+  // may iterate concurrently
+  double convTol;   //!< Convergence tolerance of the current step
+  double prevNorm;  //!< Scaled norm of the previous iteration
+  int    nIncrease; //!< Number of iterations with increasing norm
+
   std::map<int,int> slowNodes; //!< Nodes for which slow convergence is detected
 
 public:
@@ -16,6 +16,10 @@
 
 #include "SIMgeneric.h"
 
+namespace Go {
+  class SplineSurface;
+}
+
 
 /*!
   \brief Driver class for 2D NURBS-based FEM solver.
@@ -71,6 +75,17 @@ public:
   virtual bool readPatches(std::istream& isp, PatchVec& patches,
                            const char* whiteSpace) const;
 
+  //! \brief Creates a patch from an in-memory spline surface.
+  //! \param[in] spline The spline surface of the patch
+  //! \param[in] pchInd Global 1-based index of the patch
+  //! \param[out] patches Array of patches to append the new patch to
+  //! \param[in] whiteSpace For message formatting
+  //!
+  //! \details The caller is responsible for only creating the patches owned
+  //! by this process, see SIMbase::getLocalPatchIndex.
+  bool createPatch(const Go::SplineSurface& spline, int pchInd,
+                   PatchVec& patches, const char* whiteSpace = nullptr) const;
+
   //! \brief Connects two patches.
   //! \param[in] master Master patch
   //! \param[in] slave Slave patch
@@ -29,8 +29,10 @@ class SAM;
 class AlgEqSystem;
 class LinSolParams;
 class TimeStep;
+class SystemMatrix;
 class SystemVector;
 class Vec4;
+class PointLocator;
 
 //! Property code to integrand map
 typedef std::multimap<int,IntegrandBase*> IntegrandMap;
@@ -186,6 +188,13 @@ public:
   //! \brief Finds the node that is closest to the given point \b X.
   int findClosestNode(const Vec3&) const;
 
+  //! \brief Returns the spatial search structure of the model.
+  //! \details The search structure is created on the first invocation after
+  //! the model has been preprocessed, and is invalidated by the next call to
+  //! preprocess() or updateGrid(). The creation is thread safe, but the
+  //! invalidation is not, and must not happen while other threads search.
+  const PointLocator* getPointLocator() const;
+
   //! \brief Initializes time-dependent in-homogeneous Dirichlet coefficients.
   //! \param[in] time Current time
   bool initDirichlet(double time = 0.0);
@@ -550,6 +559,8 @@ public:
   //! \brief Returns the end of the property array.
   PropertyVec::const_iterator end_prop() const { return myProps.end(); }
 
+  //! \brief Returns current system left-hand-side matrix.
+  SystemMatrix* getLHSmatrix(size_t idx = 0, bool copy = false) const;
   //! \brief Returns current system light-hand-side vector.
   SystemVector* getRHSvector(size_t idx = 0, bool copy = false) const;
   //! \brief Adds a system vector to the given right-hand-side vector.
@@ -650,6 +661,11 @@ private:
   size_t nIntGP; //!< Number of interior integration points in the whole model
   size_t nBouGP; //!< Number of boundary integration points in the whole model
 
+  mutable PointLocator* myLocator; //!< Spatial search structure of the model
+
+  mutable double extEnergy;  //!< Accumulated external energy
+  mutable Vector prevForces; //!< Reaction forces of the previous step
+
   //! Additional MADOF arrays for mixed problems (extraordinary DOF counts)
   std::map<int, std::vector<int> > mixedMADOFs;
 };
@@ -41,16 +41,39 @@ private:
     std::string    name;           //!< Field name
     short int      components;     //!< Number of field components per node
     char           differentBasis; //!< Toggle usage of an independent basis
+
+    //! \brief Patch-level values of a versioned field.
+    struct PatchValues
+    {
+      unsigned int version;       //!< Field version of the extracted values
+      utl::vector<double> values; //!< The extracted patch-level values
+      //! \brief Default constructor.
+      PatchValues() : version(0) {}
+    };
+
+    mutable std::vector<PatchValues> cache; //!< Extracted values per patch
+    mutable size_t        lentPatch;   //!< Patch whose cached values are lent
+    mutable const void*   lastVec;     //!< Integrand vector last extracted to
+    mutable const double* lastData;    //!< Data pointer of \a lastVec
+    mutable size_t        lastSize;    //!< Size of \a lastVec
+    mutable size_t        lastPatch;   //!< Patch index last extracted for
+    mutable unsigned int  lastVersion; //!< Field version last extracted
+
     //! \brief Default constructor.
     Dependency(SIMdependency* s = nullptr, const std::string& f = "",
                short int n = 1) : sim(s), name(f), components(n),
-                                  differentBasis(0) {}
+                                  differentBasis(0), lentPatch(-1),
+                                  lastVec(nullptr),
+                                  lastData(nullptr), lastSize(0), lastPatch(0),
+                                  lastVersion(0) {}
   };
 
   //! \brief SIM dependency container
   typedef std::vector<Dependency> DepVector;
   //! \brief Field name to nodal values map
   typedef std::map<std::string,const utl::vector<double>*> FieldMap;
+  //! \brief Field name to version map
+  typedef std::map<std::string,unsigned int> VersionMap;
 
 protected:
   //! \brief The constructor is protected to allow sub-class instances only.
@@ -92,7 +115,26 @@ public:
   //! \brief Returns a spline patch associated with a dependent field.
   ASMbase* getDependentPatch(const std::string& name, int pindx) const;
   //! \brief Registers a named field with associated nodal vector in this SIM.
-  void registerField(const std::string& name, const utl::vector<double>& vec);
+  //! \param[in] name Name of the field
+  //! \param[in] vec The nodal values of the field
+  //! \param[in] versioned If \e true, the field is version-stamped
+  //!
+  //! \details The patch-level values of a version-stamped field are only
+  //! extracted by the dependent simulators when the version has changed.
+  //! The versions are increased by the equation solvers, the time stepping
+  //! and the coupled solution drivers, and when loading initial conditions
+  //! or restart data. The owner must call fieldUpdated() if it modifies
+  //! \a vec elsewhere, or register the field with \a versioned \e false.
+  //! The dependent integrands must not modify the values of such fields.
+  void registerField(const std::string& name, const utl::vector<double>& vec,
+                     bool versioned = true);
+  //! \brief Marks a version-stamped field as modified.
+  virtual void fieldUpdated(const std::string& name);
+  //! \brief Marks all version-stamped fields of this SIM as modified.
+  virtual void fieldsUpdated();
+  //! \brief Returns the current version of a named field in this SIM.
+  //! \return Zero if the field is not version-stamped
+  virtual unsigned int getFieldVersion(const std::string& name) const;
   //! \brief Checks whether a named initial condition is present.
   virtual bool hasIC(const std::string&) const { return false; }
 
@@ -109,8 +151,9 @@ protected:
                                 const PatchVec& model, size_t pindx) const;
 
 private:
-  FieldMap  myFields;  //!< The named fields of this SIM object
-  DepVector depFields; //!< Other fields this SIM objecy depends on
+  FieldMap   myFields;   //!< The named fields of this SIM object
+  VersionMap myVersions; //!< Versions of the version-stamped fields
+  DepVector  depFields;  //!< Other fields this SIM objecy depends on
 };
 
 #endif
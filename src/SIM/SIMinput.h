@@ -107,6 +107,13 @@ private:
   //! \brief Parses a subelement of the \a linearsolver XML-tag.
   bool parseLinSolTag(const TiXmlElement* elem);
 
+  //! \brief Distributes the patches on the processes based on their size.
+  //! \param patches All patches of the model, only the local ones are kept
+  //! \param[in] geo The \a geometry XML-tag with the patch topology
+  //! \param[in] tol Allowed load imbalance, relative to the average load
+  bool partitionPatches(PatchVec& patches, const TiXmlElement* geo,
+                        double tol);
+
 protected:
   //! \brief Parses a subelement of the \a resultoutput XML-tag.
   virtual bool parseOutputTag(const TiXmlElement* elem);
@@ -42,6 +42,8 @@ public:
 
   //! \brief Defines the linear equation solver to be used.
   void setLinearSolver(const std::string& eqsolver);
+  //! \brief Defines the equation renumbering method to use.
+  void setRenumbering(const std::string& method);
 
   //! \brief Parses a subelement of the \a console XML-tag.
   bool parseConsoleTag(const TiXmlElement* elem);
@@ -72,6 +74,7 @@ public:
 
   int solver;          //!< The linear equation solver to use
   int num_threads_SLU; //!< Number of threads for SuperLU_MT
+  int renumber;        //!< Equation renumbering (0=none, 1=RCM, 2=ND)
 
   // Eigenvalue solver options
   int    eig;   //!< Eigensolver method (1,...,5)
@@ -87,10 +90,14 @@ public:
   bool pSolOnly; //!< If \e true, don't save secondary solution variables
 
   std::string hdf5; //!< Prefix for HDF5-file
+  int hdf5Layout;   //!< HDF5 layout (0=per patch, 1=consolidated, 2=collective)
+  int hdf5Deflate;  //!< Deflate compression level of consolidated HDF5 output
+  int hdf5Async;    //!< Max. number of pending asynchronous HDF5 time levels
   bool enableController; //!< Whether or not to enable external program control
 
   int printPid; //!< PID to print info to screen for
   std::string log_prefix; //!< Prefix for process log files
+  std::string trace;      //!< Name of Chrome trace file for profiler events
 
   //! \brief Enum defining the available projection methods.
   enum ProjectionMethod { NONE, GLOBAL, DGL2, CGL2, SCR, VDSA, QUASI, LEASTSQ };
@@ -250,6 +250,10 @@ public:
   //! \param[in] psol Primary solution vector
   //! \param[in] time Load/time step parameter
   //! \param[in] step Load/time step counter
+  //!
+  //! \details If the file name has the extension \a .bin, the results are
+  //! written in binary format, as one record of native doubles for each point,
+  //! with the time followed by the primary and secondary solution values.
   bool savePoints(const Vector& psol, double time, int step) const;
 
   //! \brief Sets the file name for result point output.
@@ -268,16 +272,23 @@ private:
   struct ResultPoint
   {
     unsigned char npar;  //!< Number of parameters
-    size_t        patch; //!< Patch index [1,nPatch]
+    size_t        patch; //!< Patch index [1,nPatch], 0 if given by coordinates
     int           inod;  //!< Local node number of the closest node
     double        u[3];  //!< Parameters of the point (u,v,w)
     Vec3          X;     //!< Spatial coordinates of the point
+    std::vector<int> ip; //!< Local indices of the non-zero basis functions
+    RealArray        N;  //!< Cached basis function values at the point
     // \brief Default constructor.
     ResultPoint() : npar(0), patch(1), inod(0) { u[0] = u[1] = u[2] = 0.0; }
   };
 
   typedef std::vector<ResultPoint> ResPointVec; //!< Result point container
 
+  //! \brief Finds the patch and parameters of a point given by coordinates.
+  //! \param pt The result point, its spatial coordinates are given on input
+  //! \return \e false if the point is not within the (local) model
+  bool locateResultPoint(ResultPoint& pt) const;
+
   //! \brief Preprocesses a result sampling point group.
   //! \param ptFile Name of file that these result points are dumped to
   //! \param points Group of result points that are dumped to the given file
@@ -295,6 +306,39 @@ private:
                    utl::LogStream& os, const ResPointVec& gPoints,
                    bool formatted, std::streamsize precision) const;
 
+  //! \brief Dumps solution results at the given points in binary format.
+  //! \param[in] psol Primary solution vector to derive other quantities from
+  //! \param[in] time Load/time step parameter
+  //! \param os Output stream to write the solution data to
+  //! \param[in] gPoints Group of result points to write solution data for
+  bool dumpBinary(const Vector& psol, double time,
+                  std::ostream& os, const ResPointVec& gPoints) const;
+
+  //! \brief Evaluates the solution at the result points within a patch.
+  //! \param[in] psol Primary solution vector to derive other quantities from
+  //! \param[in] pidx 0-based local patch index
+  //! \param[in] gPoints Group of result points to evaluate
+  //! \param[out] points Local node numbers of the points matching a node,
+  //! negative (1-based) point indices for the other points
+  //! \param[out] sol1 Primary solution at the points
+  //! \param[out] sol2 Secondary solution at the points
+  bool evalResults(const Vector& psol, size_t pidx, const ResPointVec& gPoints,
+                   std::vector<int>& points, Matrix& sol1, Matrix& sol2) const;
+
+  //! \brief Evaluates the primary solution at result points within a patch.
+  //! \param[in] pch The patch to evaluate the solution on
+  //! \param[in] locSol Solution vector local to the patch
+  //! \param[in] pts The result points to evaluate at
+  //! \param[in] params Parameter values of the result points
+  //! \param[out] sol Primary solution at the points
+  //!
+  //! \details The cached basis function values of the points are used when
+  //! available, such that the evaluation is a small sparse matrix-vector
+  //! product only. Otherwise, ASMbase::evalSolution is invoked.
+  bool evalPrimary(const ASMbase* pch, const Vector& locSol,
+                   const std::vector<const ResultPoint*>& pts,
+                   const RealArray* params, Matrix& sol) const;
+
   typedef std::pair<std::string,ResPointVec> ResPtPair; //!< Result point group
 
   std::vector<ResPtPair> myPoints; //!< User-defined result sampling points
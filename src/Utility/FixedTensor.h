@@ -0,0 +1,629 @@
+// $Id$
+//==============================================================================
+//!
+//! \file FixedTensor.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author SINTEF Digital
+//!
+//! \brief Fixed-size point vectors and second-order tensors.
+//!
+//==============================================================================
+
+#ifndef _FIXED_TENSOR_H
+#define _FIXED_TENSOR_H
+
+#include "Vec3.h"
+#include "Tensor.h"
+#include <algorithm>
+
+
+/*!
+  \brief Class template for a point vector with compile-time dimension.
+  \details Unlike Vec3, this is a plain value type without virtual methods
+  and reference members, such that it is trivially copyable and occupies
+  exactly \a N components.
+*/
+
+template<unsigned short N> class FixedVec
+{
+  static_assert(N >= 1 && N <= 3, "FixedVec dimension must be 1, 2 or 3");
+
+  Real v[N]; //!< The vector components
+
+public:
+  //! \brief Default constructor creating a zero vector.
+  FixedVec() { std::fill(v,v+N,Real(0)); }
+  //! \brief Constructor creating a vector with all components equal \a val.
+  explicit FixedVec(Real val) { std::fill(v,v+N,val); }
+  //! \brief Constructor copying the first \a N components of a Vec3.
+  explicit FixedVec(const Vec3& X) { std::copy(X.ptr(),X.ptr()+N,v); }
+
+  //! \brief Conversion to a Vec3, for calling legacy code.
+  Vec3 toVec3() const { return Vec3(v,N); }
+
+  //! \brief Returns the dimension of this vector.
+  static unsigned short dim() { return N; }
+
+  //! \brief Index-0 based component reference.
+  const Real& operator[](unsigned short i) const { return v[i]; }
+  //! \brief Index-0 based component access.
+  Real& operator[](unsigned short i) { return v[i]; }
+  //! \brief Index-1 based component reference.
+  const Real& operator()(unsigned short i) const { return v[i-1]; }
+  //! \brief Index-1 based component access.
+  Real& operator()(unsigned short i) { return v[i-1]; }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v; }
+
+  //! \brief Overloaded assignment operator.
+  FixedVec& operator=(Real val) { std::fill(v,v+N,val); return *this; }
+
+  //! \brief Incrementation operator.
+  FixedVec& operator+=(const FixedVec& X)
+  {
+    for (unsigned short i = 0; i < N; i++) v[i] += X.v[i];
+    return *this;
+  }
+
+  //! \brief Decrementation operator.
+  FixedVec& operator-=(const FixedVec& X)
+  {
+    for (unsigned short i = 0; i < N; i++) v[i] -= X.v[i];
+    return *this;
+  }
+
+  //! \brief Scaling operator.
+  FixedVec& operator*=(Real c)
+  {
+    for (unsigned short i = 0; i < N; i++) v[i] *= c;
+    return *this;
+  }
+
+  //! \brief Division by a scalar.
+  FixedVec& operator/=(Real d)
+  {
+    for (unsigned short i = 0; i < N; i++) v[i] /= d;
+    return *this;
+  }
+
+  //! \brief Returns the dot product of \a *this and the given vector.
+  Real dot(const FixedVec& X) const
+  {
+    Real value = Real(0);
+    for (unsigned short i = 0; i < N; i++) value += v[i]*X.v[i];
+    return value;
+  }
+
+  //! \brief Returns the square of the length of the vector.
+  Real length2() const { return this->dot(*this); }
+  //! \brief Returns the length of the vector.
+  Real length() const { return sqrt(this->length2()); }
+
+  //! \brief Normalizes the vector and returns its length.
+  Real normalize(Real tol = Real(1.0e-16))
+  {
+    Real len = this->length();
+    if (len > tol) *this /= len;
+    return len;
+  }
+};
+
+
+/*!
+  \brief Class template for a non-symmetric second-order tensor with
+  compile-time dimension.
+  \details The components are stored column-wise, as in Tensor.
+*/
+
+template<unsigned short N> class FixedTensor
+{
+  static_assert(N >= 1 && N <= 3, "FixedTensor dimension must be 1, 2 or 3");
+
+  Real v[N*N]; //!< The tensor components
+
+  //! \brief Inverts the tensor, given its non-zero determinant.
+  void invert(Real det);
+
+public:
+  //! \brief Constructor creating a zero or identity tensor.
+  explicit FixedTensor(bool identity = false)
+  {
+    std::fill(v,v+N*N,Real(0));
+    if (identity) this->diag(Real(1));
+  }
+
+  //! \brief Constructor copying the components of a Tensor of any dimension.
+  //! \details Components outside the dimension of \a T are set to zero.
+  explicit FixedTensor(const Tensor& T)
+  {
+    for (unsigned short j = 1; j <= N; j++)
+      for (unsigned short i = 1; i <= N; i++)
+        (*this)(i,j) = i <= T.dim() && j <= T.dim() ? T(i,j) : Real(0);
+  }
+
+  //! \brief Conversion to a Tensor, for calling legacy code.
+  Tensor toTensor() const { return Tensor(std::vector<Real>(v,v+N*N)); }
+
+  //! \brief Returns the dimension of this tensor.
+  static unsigned short dim() { return N; }
+  //! \brief Returns the number of tensor components.
+  static size_t size() { return N*N; }
+
+  //! \brief Index-1 based component reference.
+  const Real& operator()(unsigned short i, unsigned short j) const
+  { return v[i-1 + N*(j-1)]; }
+  //! \brief Index-1 based component access.
+  Real& operator()(unsigned short i, unsigned short j)
+  { return v[i-1 + N*(j-1)]; }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v; }
+
+  //! \brief Sets \a *this to the 0-tensor.
+  void zero() { std::fill(v,v+N*N,Real(0)); }
+  //! \brief Sets \a *this to a diagonal tensor with \a value on the diagonal.
+  void diag(Real value)
+  {
+    this->zero();
+    for (unsigned short i = 0; i < N; i++) v[i*(N+1)] = value;
+  }
+
+  //! \brief Incrementation operator.
+  FixedTensor& operator+=(const FixedTensor& T)
+  {
+    for (unsigned short i = 0; i < N*N; i++) v[i] += T.v[i];
+    return *this;
+  }
+
+  //! \brief Decrementation operator.
+  FixedTensor& operator-=(const FixedTensor& T)
+  {
+    for (unsigned short i = 0; i < N*N; i++) v[i] -= T.v[i];
+    return *this;
+  }
+
+  //! \brief Scaling operator.
+  FixedTensor& operator*=(Real c)
+  {
+    for (unsigned short i = 0; i < N*N; i++) v[i] *= c;
+    return *this;
+  }
+
+  //! \brief Dyadic (outer) product between two vectors.
+  FixedTensor& outerProd(const FixedVec<N>& a, const FixedVec<N>& b)
+  {
+    for (unsigned short j = 0; j < N; j++)
+      for (unsigned short i = 0; i < N; i++)
+        v[i+N*j] = a[i]*b[j];
+    return *this;
+  }
+
+  //! \brief Returns the inner-product of \a *this and the given tensor.
+  Real innerProd(const FixedTensor& T) const
+  {
+    Real value = Real(0);
+    for (unsigned short i = 0; i < N*N; i++) value += v[i]*T.v[i];
+    return value;
+  }
+
+  //! \brief Returns the transpose of this tensor.
+  FixedTensor transposed() const
+  {
+    FixedTensor T;
+    for (unsigned short j = 1; j <= N; j++)
+      for (unsigned short i = 1; i <= N; i++)
+        T(j,i) = (*this)(i,j);
+    return T;
+  }
+
+  //! \brief Returns the trace of the tensor.
+  Real trace() const
+  {
+    Real t = Real(0);
+    for (unsigned short i = 0; i < N; i++) t += v[i*(N+1)];
+    return t;
+  }
+
+  //! \brief Returns the determinant of the tensor.
+  Real det() const;
+
+  //! \brief Inverts the tensor.
+  //! \param[in] tol Division by zero tolerance
+  //! \return Determinant of the tensor, zero if singular
+  Real inverse(Real tol = Real(0));
+};
+
+
+/*!
+  \brief Class template for a symmetric second-order tensor with
+  compile-time dimension.
+  \details The components are stored in the same order as in SymmTensor, i.e.,
+  s11, s22, s33, s12, s23, s13 in 3D, and s11, s22, s12 in 2D.
+*/
+
+template<unsigned short N> class FixedSymmTensor
+{
+  static const unsigned short M = N*(N+1)/2; //!< Number of components
+
+  static_assert(N >= 1 && N <= 3, "FixedSymmTensor dimension must be 1, 2 or 3");
+
+  Real v[M]; //!< The tensor components
+
+  //! \brief Inverts the tensor, given its non-zero determinant.
+  void invert(Real det);
+
+  //! \brief Returns a 0-based array index for the given tensor indices.
+  static unsigned short index(unsigned short i, unsigned short j)
+  {
+    if (i == j)
+      return i-1; // diagonal term
+    else if (N == 2)
+      return 2; // off-diagonal term (2D)
+
+    if (i == j+1 || i+2 == j) std::swap(i,j);
+    return i+2; // upper triangular term (3D)
+  }
+
+public:
+  //! \brief Constructor creating a zero or identity tensor.
+  explicit FixedSymmTensor(bool identity = false)
+  {
+    std::fill(v,v+M,Real(0));
+    if (identity) std::fill(v,v+N,Real(1));
+  }
+
+  //! \brief Constructor copying the components of a SymmTensor.
+  //! \details Components outside the dimension of \a T are set to zero.
+  explicit FixedSymmTensor(const SymmTensor& T)
+  {
+    for (unsigned short i = 1; i <= N; i++)
+      for (unsigned short j = i; j <= N; j++)
+        v[index(i,j)] = i <= T.dim() && j <= T.dim() ? T(i,j) : Real(0);
+  }
+
+  //! \brief Conversion to a SymmTensor, for calling legacy code.
+  SymmTensor toSymmTensor() const
+  {
+    return SymmTensor(std::vector<Real>(v,v+M));
+  }
+
+  //! \brief Returns the dimension of this tensor.
+  static unsigned short dim() { return N; }
+  //! \brief Returns the number of tensor components.
+  static size_t size() { return M; }
+
+  //! \brief Index-1 based component reference.
+  const Real& operator()(unsigned short i, unsigned short j) const
+  { return v[index(i,j)]; }
+  //! \brief Index-1 based component access.
+  Real& operator()(unsigned short i, unsigned short j)
+  { return v[index(i,j)]; }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v; }
+
+  //! \brief Sets \a *this to the 0-tensor.
+  void zero() { std::fill(v,v+M,Real(0)); }
+
+  //! \brief Incrementation operator.
+  FixedSymmTensor& operator+=(const FixedSymmTensor& T)
+  {
+    for (unsigned short i = 0; i < M; i++) v[i] += T.v[i];
+    return *this;
+  }
+
+  //! \brief Adds a scaled unit tensor to \a *this.
+  FixedSymmTensor& operator+=(Real a)
+  {
+    for (unsigned short i = 0; i < N; i++) v[i] += a;
+    return *this;
+  }
+
+  //! \brief Decrementation operator.
+  FixedSymmTensor& operator-=(const FixedSymmTensor& T)
+  {
+    for (unsigned short i = 0; i < M; i++) v[i] -= T.v[i];
+    return *this;
+  }
+
+  //! \brief Scaling operator.
+  FixedSymmTensor& operator*=(Real c)
+  {
+    for (unsigned short i = 0; i < M; i++) v[i] *= c;
+    return *this;
+  }
+
+  //! \brief Dyadic (outer) product between two identical vectors.
+  FixedSymmTensor& outerProd(const FixedVec<N>& u)
+  {
+    for (unsigned short i = 1; i <= N; i++)
+      for (unsigned short j = i; j <= N; j++)
+        v[index(i,j)] = u(i)*u(j);
+    return *this;
+  }
+
+  //! \brief Constructs the right Cauchy-Green tensor from a deformation tensor.
+  FixedSymmTensor& rightCauchyGreen(const FixedTensor<N>& F)
+  {
+    for (unsigned short i = 1; i <= N; i++)
+      for (unsigned short j = i; j <= N; j++)
+      {
+        Real& c = v[index(i,j)];
+        c = Real(0);
+        for (unsigned short k = 1; k <= N; k++)
+          c += F(k,i)*F(k,j);
+      }
+    return *this;
+  }
+
+  //! \brief Returns the double contraction (:-operator) with another tensor.
+  Real ddot(const FixedSymmTensor& T) const
+  {
+    Real value = Real(0);
+    for (unsigned short i = 0; i < M; i++)
+      value += (i < N ? Real(1) : Real(2))*v[i]*T.v[i];
+    return value;
+  }
+
+  //! \brief Returns the inner-product (L2-norm) of the symmetric tensor.
+  Real L2norm(bool doSqrt = true) const
+  {
+    Real l2n = this->ddot(*this);
+    return doSqrt ? sqrt(l2n) : l2n;
+  }
+
+  //! \brief Returns the trace of the tensor.
+  Real trace() const
+  {
+    Real t = Real(0);
+    for (unsigned short i = 0; i < N; i++) t += v[i];
+    return t;
+  }
+
+  //! \brief Returns the determinant of the tensor.
+  Real det() const;
+
+  //! \brief Inverts the tensor.
+  //! \param[in] tol Division by zero tolerance
+  //! \return Determinant of the tensor, zero if singular
+  Real inverse(Real tol = Real(0));
+
+  //! \brief Returns the von Mises value of the symmetric tensor.
+  Real vonMises(bool doSqrt = true) const;
+};
+
+
+//! \brief Adds two fixed-size vectors.
+template<unsigned short N> inline
+FixedVec<N> operator+(FixedVec<N> a, const FixedVec<N>& b) { return a += b; }
+
+//! \brief Subtracts two fixed-size vectors.
+template<unsigned short N> inline
+FixedVec<N> operator-(FixedVec<N> a, const FixedVec<N>& b) { return a -= b; }
+
+//! \brief Multiplication between a scalar and a fixed-size vector.
+template<unsigned short N> inline
+FixedVec<N> operator*(Real c, FixedVec<N> a) { return a *= c; }
+
+//! \brief Cross product between two fixed-size 3D vectors.
+inline FixedVec<3> cross(const FixedVec<3>& a, const FixedVec<3>& b)
+{
+  FixedVec<3> c;
+  c[0] = a[1]*b[2] - a[2]*b[1];
+  c[1] = a[2]*b[0] - a[0]*b[2];
+  c[2] = a[0]*b[1] - a[1]*b[0];
+  return c;
+}
+
+//! \brief Adds two fixed-size tensors.
+template<unsigned short N> inline
+FixedTensor<N> operator+(FixedTensor<N> A, const FixedTensor<N>& B)
+{
+  return A += B;
+}
+
+//! \brief Subtracts two fixed-size tensors.
+template<unsigned short N> inline
+FixedTensor<N> operator-(FixedTensor<N> A, const FixedTensor<N>& B)
+{
+  return A -= B;
+}
+
+//! \brief Multiplication between a scalar and a fixed-size tensor.
+template<unsigned short N> inline
+FixedTensor<N> operator*(Real c, FixedTensor<N> A) { return A *= c; }
+
+//! \brief Multiplication between two fixed-size tensors.
+template<unsigned short N> inline
+FixedTensor<N> operator*(const FixedTensor<N>& A, const FixedTensor<N>& B)
+{
+  FixedTensor<N> C;
+  for (unsigned short j = 1; j <= N; j++)
+    for (unsigned short k = 1; k <= N; k++)
+      for (unsigned short i = 1; i <= N; i++)
+        C(i,j) += A(i,k)*B(k,j);
+  return C;
+}
+
+//! \brief Multiplication between a fixed-size tensor and a vector.
+template<unsigned short N> inline
+FixedVec<N> operator*(const FixedTensor<N>& T, const FixedVec<N>& a)
+{
+  FixedVec<N> b;
+  for (unsigned short j = 1; j <= N; j++)
+    for (unsigned short i = 1; i <= N; i++)
+      b(i) += T(i,j)*a(j);
+  return b;
+}
+
+//! \brief Adds two fixed-size symmetric tensors.
+template<unsigned short N> inline
+FixedSymmTensor<N> operator+(FixedSymmTensor<N> A, const FixedSymmTensor<N>& B)
+{
+  return A += B;
+}
+
+//! \brief Subtracts two fixed-size symmetric tensors.
+template<unsigned short N> inline
+FixedSymmTensor<N> operator-(FixedSymmTensor<N> A, const FixedSymmTensor<N>& B)
+{
+  return A -= B;
+}
+
+//! \brief Multiplication between a scalar and a fixed-size symmetric tensor.
+template<unsigned short N> inline
+FixedSymmTensor<N> operator*(Real c, FixedSymmTensor<N> A) { return A *= c; }
+
+//! \brief Multiplication between a fixed-size symmetric tensor and a vector.
+template<unsigned short N> inline
+FixedVec<N> operator*(const FixedSymmTensor<N>& S, const FixedVec<N>& a)
+{
+  FixedVec<N> b;
+  for (unsigned short j = 1; j <= N; j++)
+    for (unsigned short i = 1; i <= N; i++)
+      b(i) += S(i,j)*a(j);
+  return b;
+}
+
+//! \brief Double contraction (:-operator) of two fixed-size symmetric tensors.
+template<unsigned short N> inline
+Real ddot(const FixedSymmTensor<N>& A, const FixedSymmTensor<N>& B)
+{
+  return A.ddot(B);
+}
+
+
+template<> inline Real FixedTensor<1>::det() const { return v[0]; }
+
+template<> inline Real FixedTensor<2>::det() const
+{
+  return v[0]*v[3] - v[1]*v[2];
+}
+
+template<> inline Real FixedTensor<3>::det() const
+{
+  return v[0]*(v[4]*v[8] - v[5]*v[7])
+    -    v[3]*(v[1]*v[8] - v[2]*v[7])
+    +    v[6]*(v[1]*v[5] - v[2]*v[4]);
+}
+
+template<> inline void FixedTensor<1>::invert(Real det)
+{
+  v[0] = Real(1) / det;
+}
+
+template<> inline void FixedTensor<2>::invert(Real det)
+{
+  std::swap(v[0],v[3]);
+  v[0] /=  det; v[1] /= -det;
+  v[2] /= -det; v[3] /=  det;
+}
+
+template<> inline void FixedTensor<3>::invert(Real det)
+{
+  Real T11 = v[0]; Real T12 = v[3]; Real T13 = v[6];
+  Real T21 = v[1]; Real T22 = v[4]; Real T23 = v[7];
+  Real T31 = v[2]; Real T32 = v[5]; Real T33 = v[8];
+  v[0] =  (T22*T33 - T32*T23) / det;
+  v[1] = -(T21*T33 - T31*T23) / det;
+  v[2] =  (T21*T32 - T31*T22) / det;
+  v[3] = -(T12*T33 - T32*T13) / det;
+  v[4] =  (T11*T33 - T31*T13) / det;
+  v[5] = -(T11*T32 - T31*T12) / det;
+  v[6] =  (T12*T23 - T22*T13) / det;
+  v[7] = -(T11*T23 - T21*T13) / det;
+  v[8] =  (T11*T22 - T21*T12) / det;
+}
+
+template<unsigned short N> inline Real FixedTensor<N>::inverse(Real tol)
+{
+  Real det = this->det();
+  if (det <= tol && det >= -tol)
+  {
+    std::cerr <<"FixedTensor::inverse: Singular tensor |T|="<< det << std::endl;
+    return Real(0);
+  }
+
+  this->invert(det);
+  return det;
+}
+
+
+template<> inline Real FixedSymmTensor<1>::det() const { return v[0]; }
+
+template<> inline Real FixedSymmTensor<2>::det() const
+{
+  return v[0]*v[1] - v[2]*v[2];
+}
+
+template<> inline Real FixedSymmTensor<3>::det() const
+{
+  return v[0]*(v[1]*v[2] - v[4]*v[4])
+    -    v[3]*(v[3]*v[2] - v[5]*v[4])
+    +    v[5]*(v[3]*v[4] - v[5]*v[1]);
+}
+
+template<> inline void FixedSymmTensor<1>::invert(Real det)
+{
+  v[0] = Real(1) / det;
+}
+
+template<> inline void FixedSymmTensor<2>::invert(Real det)
+{
+  std::swap(v[0],v[1]);
+  v[0] /= det; v[1] /= det; v[2] /= -det;
+}
+
+template<> inline void FixedSymmTensor<3>::invert(Real det)
+{
+  Real T11 = v[0];
+  Real T21 = v[3]; Real T22 = v[1];
+  Real T31 = v[5]; Real T32 = v[4]; Real T33 = v[2];
+  v[0] =  (T22*T33 - T32*T32) / det;
+  v[1] =  (T11*T33 - T31*T31) / det;
+  v[2] =  (T11*T22 - T21*T21) / det;
+  v[3] = -(T21*T33 - T31*T32) / det;
+  v[4] = -(T11*T32 - T31*T21) / det;
+  v[5] =  (T21*T32 - T31*T22) / det;
+}
+
+template<unsigned short N> inline Real FixedSymmTensor<N>::inverse(Real tol)
+{
+  Real det = this->det();
+  if (det <= tol && det >= -tol)
+  {
+    std::cerr <<"FixedSymmTensor::inverse: Singular tensor |T|="<< det
+              << std::endl;
+    return Real(0);
+  }
+
+  this->invert(det);
+  return det;
+}
+
+template<unsigned short N>
+inline Real FixedSymmTensor<N>::vonMises(bool doSqrt) const
+{
+  if (N == 1)
+    return doSqrt ? v[0] : v[0]*v[0];
+
+  Real s33 = N == 3 ? v[2] : Real(0);
+  Real vms = v[0]*(v[0]-v[1]) + v[1]*(v[1]-s33) + s33*(s33-v[0]);
+  for (unsigned short i = N; i < M; i++)
+    vms += Real(3)*v[i]*v[i];
+
+  return doSqrt ? sqrt(vms) : vms;
+}
+
+
+typedef FixedVec<2>        FixedVec2;        //!< Fixed-size 2D point vector
+typedef FixedVec<3>        FixedVec3;        //!< Fixed-size 3D point vector
+typedef FixedTensor<2>     FixedTensor2;     //!< Fixed-size 2D tensor
+typedef FixedTensor<3>     FixedTensor3;     //!< Fixed-size 3D tensor
+typedef FixedSymmTensor<2> FixedSymmTensor2; //!< Fixed-size symmetric 2D tensor
+typedef FixedSymmTensor<3> FixedSymmTensor3; //!< Fixed-size symmetric 3D tensor
+
+#endif
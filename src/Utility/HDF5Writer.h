@@ -25,6 +25,15 @@ class SIMbase;
   \details The HDF5 writer writes data to a HDF5 file.
   It supports parallel I/O, and can be used to add restart capability
   to applications.
+
+  In asynchronous mode (see setAsync), the result data of each time level
+  are copied into a snapshot when the file is closed, and the actual HDF5
+  output is done by a background thread while the simulation continues.
+
+  When reading, e.g., for restart, an index of the time levels and datasets
+  in the file is built lazily, and only the patches owned by the process are
+  read. Uncompressed datasets with contiguous storage are read directly from
+  a memory map of the file, see mapVector.
 */
 
 class HDF5Writer : public DataWriter
@@ -37,8 +46,40 @@ public:
   HDF5Writer(const std::string& name, const ProcessAdm& adm, bool append = false,
              bool keepopen = false);
 
-  //! \brief Empty destructor.
-  virtual ~HDF5Writer() {}
+  //! \brief The destructor waits for pending output and closes the file.
+  virtual ~HDF5Writer();
+
+  //! \brief Enables asynchronous output through a background writer thread.
+  //! \param[in] maxPending Maximum number of time level snapshots waiting to
+  //! be written before the simulation is blocked (1 gives double buffering)
+  //! \return \e false if asynchronous output is not available
+  //!
+  //! \details The solution extraction and secondary solution recovery are
+  //! still done by the calling thread, only the file output is deferred.
+  //! Asynchronous output is not supported for parallel runs, and it is
+  //! intended for result files only, not for files that are read from.
+  bool setAsync(size_t maxPending = 1);
+
+  //! \brief Blocks until all pending asynchronous output has been written.
+  void flush();
+
+  //! \brief Enables the consolidated layout for patch-wise results.
+  //! \param[in] deflate Deflate compression level (0 means no compression)
+  //! \param[in] chunk Chunk size (number of values) of the datasets
+  //!
+  //! \details Instead of one dataset per field and patch, all patches of a
+  //! field are concatenated into one chunked dataset \a level/fields/name/data,
+  //! with the (offset,length) pairs of the patches in \a level/fields/name/index.
+  //! The reading methods detect the layout automatically.
+  void setConsolidated(int deflate = 0, int chunk = 65536);
+  //! \brief Enables collective I/O with the consolidated layout.
+  //! \param[in] deflate Deflate compression level (0 means no compression)
+  //! \param[in] chunk Chunk size (number of values) of the datasets
+  //!
+  //! \details In parallel runs, each process then writes all its patches of a
+  //! field as one contiguous slab, in a single collective write. The offsets
+  //! of the slabs are computed once per field and reused for later levels.
+  void setCollective(int deflate = 0, int chunk = 65536);
 
   //! \brief Returns the last time level stored in the HDF5 file.
   virtual int getLastTimeLevel();
@@ -120,6 +161,19 @@ public:
   bool readVector(int level, const std::string& name,
                   int patch, std::vector<double>& vec);
 
+  //! \brief Returns a double vector mapped directly from file.
+  //! \param[in] level The time level to read at
+  //! \param[in] name The name (path in HDF5 file) to the vector
+  //! \param[in] patch The patch to read (-1 for a global vector)
+  //! \param[out] len The length of the vector
+  //! \return Pointer to the vector data, or nullptr if it can not be mapped
+  //!
+  //! \details Only uncompressed datasets with contiguous storage (i.e., not
+  //! in the consolidated layout) can be mapped, use readVector otherwise.
+  //! The pointer is valid until the file is written to or the writer deleted.
+  const double* mapVector(int level, const std::string& name,
+                          int patch, size_t& len);
+
   //! \brief Reads an integer vector.
   //! \param[in] level The time level to read at
   //! \param[in] name The name (path in HDF5 file) to the string
@@ -142,14 +196,68 @@ public:
   bool hasGeometries(int level, const std::string& basisName = "");
 
 protected:
+  //! \brief Data types of the arrays written to file.
+  enum ArrayType { ARRAY_DOUBLE, ARRAY_INT, ARRAY_CHAR };
+
   //! \brief Internal helper function. Writes a data array to HDF5 file.
   //! \param[in] group The HDF5 group to write data into
   //! \param[in] name The name of the array
   //! \param[in] len The length of the array
   //! \param[in] data The array to write
-  //! \param[in] type The HDF5 type for the data (see H5T)
+  //! \param[in] type The data type of the array
+  //! \param[in] chunked If \e true, use chunked (and compressed) storage
   void writeArray(int group, const std::string& name,
-                  int len, const void* data, int type);
+                  int len, const void* data, ArrayType type,
+                  bool chunked = false);
+
+  //! \brief Internal helper function. Writes a slab of a dataset.
+  //! \param[in] group The HDF5 group to write data into
+  //! \param[in] name The name of the dataset
+  //! \param[in] size The global length of the dataset
+  //! \param[in] offset Start of the slab written by this process
+  //! \param[in] len The length of the slab written by this process
+  //! \param[in] data The slab data to write
+  //! \param[in] type The data type of the array
+  //! \param[in] chunked If \e true, use chunked (and compressed) storage
+  void writeDataset(int group, const std::string& name,
+                    int size, int offset, int len,
+                    const void* data, ArrayType type, bool chunked = false);
+
+  //! \brief Internal helper function. Writes a patch-wise result array.
+  //! \param[in] group The HDF5 group of the patch (unused if consolidated)
+  //! \param[in] patch 0-based global patch index
+  //! \param[in] name The name of the array
+  //! \param[in] len The length of the array
+  //! \param[in] data The array to write
+  void writePatchArray(int group, int patch, const std::string& name,
+                       int len, const double* data);
+  //! \brief Internal helper function. Writes the consolidated datasets.
+  //! \param[in] level The time level to write the datasets at
+  void writeConsolidated(int level);
+  //! \brief Internal helper function. Reads a patch-wise result array.
+  //! \param[in] level The time level to read at
+  //! \param[in] patch 1-based global patch index
+  //! \param[in] name The name of the array
+  //! \param[out] data The array to read data into
+  bool readPatchArray(int level, int patch, const std::string& name,
+                      std::vector<double>& data);
+  //! \brief Internal helper function. Reads (a slab of) a double dataset.
+  //! \param[in] path The path of the dataset in the HDF5 file
+  //! \param[out] data The array to read data into
+  //! \param[in] start Start of the slab to read
+  //! \param[in] count Length of the slab to read (0 means the whole dataset)
+  bool readDataset(const std::string& path, std::vector<double>& data,
+                   size_t start = 0, size_t count = 0);
+
+  //! \brief Internal helper function. Opens a group, creating it if needed.
+  //! \param[in] path The path of the group in the HDF5 file
+  //! \return The group handle (negative in asynchronous mode)
+  int openGroup(const std::string& path);
+  //! \brief Internal helper function. Closes a group opened by openGroup.
+  void closeGroup(int group);
+  //! \brief Internal helper function. Checks if a group exists in the file.
+  //! \details In asynchronous mode, the groups recorded for output are checked.
+  bool hasGroup(const std::string& path);
 
   //! \brief Internal helper function. Writes a SIM's basis (geometry) to file.
   //! \param[in] SIM The SIM we want to write basis for
@@ -180,10 +288,50 @@ protected:
   //! \return \e true if group exists, otherwise \e false
   bool checkGroupExistence(int parent, const char* group);
 
+  //! \brief Internal helper function. Opens or creates the HDF5 file.
+  //! \param[in] parallel If \e true, use the MPI-IO driver when available
+  bool openHandle(bool parallel = true);
+  //! \brief Internal helper function. Flushes and closes the HDF5 file.
+  void closeHandle();
+
 private:
+  class AsyncQueue;
+  class ReadIndex;
+
+  //! \brief Returns the read index of the file, creating it if needed.
+  ReadIndex* getIndex();
+
+  //! \brief Patch-wise arrays of a field in the consolidated layout.
+  struct PatchArrays
+  {
+    std::vector<double> data;  //!< Concatenated data of the local patches
+    std::vector<int>    index; //!< Local (offset,length) pair of each patch
+  };
+
+  //! \brief Parallel layout of a consolidated field.
+  struct Layout
+  {
+    std::vector<int> local; //!< Local patch index the layout was computed for
+    std::vector<int> index; //!< Global (offset,length) pair of each patch
+    int              start; //!< Offset of the slab of this process
+    int              size;  //!< Global size of the dataset
+  };
+
+
   int          m_file; //!< The HDF5 handle for our file
   unsigned int m_flag; //!< The file flags to open HDF5 file with
   bool     m_keepOpen; //!< If \e true, we always keep the file open
+  AsyncQueue* m_queue; //!< Snapshot queue of the background writer thread
+  ReadIndex*  m_index; //!< Lazily built index of the file for reading
+
+  bool m_consolidate; //!< If \e true, use the consolidated layout
+  bool m_collective;  //!< If \e true, use collective parallel writes
+  int  m_deflate;     //!< Deflate level of the consolidated datasets
+  int  m_chunk;       //!< Chunk size of the consolidated datasets
+  //! Patch-wise result fields of current time level in consolidated layout
+  std::map<std::string,PatchArrays> m_fields;
+  //! Cached parallel layouts of the consolidated fields
+  std::map<std::string,Layout> m_layouts;
 #ifdef HAVE_MPI
   const ProcessAdm& m_adm;   //!< Pointer to process adm in use
 #endif
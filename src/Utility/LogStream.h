@@ -21,7 +21,15 @@
 
 namespace utl {
 
-//! \brief Logging stream class.
+/*!
+  \brief Logging stream class.
+
+  \details The output operations are serialized between threads, such that
+  a stream shared by concurrently running solvers, e.g., IFEM::cout, may be
+  written to from several threads. The output of the threads may then be
+  interleaved, but the wrapped streams are not accessed concurrently.
+*/
+
 class LogStream
 {
 public:
@@ -54,10 +62,13 @@ public:
   template<typename T>
   LogStream& write(const T& data)
   {
-    if (m_ppid == m_pid && m_out)
-      *m_out << data;
-    for (auto extra : m_extra)
-      *extra << data;
+#pragma omp critical(LogStream)
+    {
+      if (m_ppid == m_pid && m_out)
+        *m_out << data;
+      for (auto extra : m_extra)
+        *extra << data;
+    }
 
     return *this;
   }
@@ -29,8 +29,19 @@
   arbitrary number of times, and the average time consumption is then also
   recorded along with the number of invokations.
 
+  The task names are interned into integer IDs once for each call site
+  (see the PROFILE macro), such that starting and stopping a timer only
+  amounts to an indexed array access. Each thread has its own set of timers,
+  which makes it possible to profile tasks inside threaded assembly loops
+  without any locking. Inside inactive regions nested in a parallel region,
+  the timers of the enclosing thread are used. The CPU time is measured for
+  the whole process, therefore only the wall clock time is recorded for the
+  thread-local timers.
+
   The profiling results are printed in a nicely formatted table when the
   profiler object goes out of scope, typically at the end of the program.
+  Optionally, all timer events can also be recorded and written to a file
+  in the Chrome trace (JSON) format, which can be viewed as a nested timeline.
 */
 
 class Profiler
@@ -46,21 +57,41 @@ public:
   //! \brief The destructor prints the profiling report to the console.
   ~Profiler();
 
+  //! \brief Returns the unique ID of the task \a funcName.
+  //! \details A new ID is assigned the first time a task name is seen.
+  static size_t getID(const std::string& funcName);
+
   //! \brief Starts profiling of task \a funcName and increments \a nRunners.
-  void start(const std::string& funcName);
+  void start(const std::string& funcName) { this->start(getID(funcName)); }
   //! \brief Stops profiling of task \a funcName and decrements \a nRunners.
   void stop(const std::string& funcName);
+  //! \brief Starts profiling of the task with ID \a funcID.
+  void start(size_t funcID);
+  //! \brief Stops profiling of the task with ID \a funcID.
+  void stop(size_t funcID);
 
   //! \brief Prints a profiling report for all tasks that have been measured.
   void report(std::ostream& os) const;
+  //! \brief Prints min/max/average wall times of the tasks over all processes.
+  //! \details This is a collective operation when running with MPI.
+  void reportParallel(std::ostream& os) const;
   //! \brief Clears the profiler.
-  void clear() { myTimers.clear(); allCPU = allWall = 0.0; nRunners = 0; }
+  void clear();
+
+  //! \brief Enables recording of timer events for trace export.
+  //! \param[in] fileName Name of Chrome trace file to write on destruction
+  //!
+  //! \details This is invoked by IFEM::Init() with the \a -trace option,
+  //! after MPI has been initialized such that each process gets its own file.
+  void setTraceFile(const std::string& fileName);
+  //! \brief Writes the recorded timer events in the Chrome trace format.
+  void writeTrace(std::ostream& os) const;
 
 private:
   //! \brief Stores profiling data for one computational task.
   struct Profile
   {
-    clock_t startCPU;  //!< The last starting CPU time of this task
+    clock_t startCPU;  //!< The last starting CPU time of this task (serial)
     double  startWall; //!< The last starting wall clock time of this task
     double  totalCPU;  //!< Total CPU time consumed by this task so far
     double  totalWall; //!< Total wall clock time consumed by this task so far
@@ -73,18 +104,36 @@ private:
     bool haveTime() const { return totalCPU >= 0.005 || totalWall >= 0.005; }
   };
 
+  //! \brief Stores a recorded begin or end event for trace export.
+  struct Event
+  {
+    size_t id;   //!< Task ID
+    double time; //!< Wall clock time of the event
+    char   type; //!< Event type ('B' = begin, 'E' = end)
+  };
+
   //! \brief Global stream operator printing a Profile instance.
   friend std::ostream& operator<<(std::ostream& os, const Profile& p);
 
+  //! \brief Prints the wall time and number of calls of a Profile instance.
+  static std::ostream& printWall(std::ostream& os, const Profile& p);
+  //! \brief Prints a task name padded to the width of the first column.
+  static void printName(std::ostream& os, size_t funcID);
+
   std::string myName; //!< Name of this profiler
 
-  typedef std::map<std::string,Profile> ProfileMap; //!< Map of profilers
+  typedef std::vector<Profile> ProfileVec; //!< Task profiles indexed on ID
+
+  ProfileVec              myTimers;  //!< The task profiles
+  std::vector<ProfileVec> myMTimers; //!< Task profiles for each thread
 
-  ProfileMap              myTimers;  //!< The task profiles with names
-  std::vector<ProfileMap> myMTimers; //!< Task profiles with names and thread iD
+  bool                            tracing; //!< If \e true, record events
+  std::string                     myTrace; //!< Name of trace file
+  std::vector<std::vector<Event>> myEvents; //!< Recorded events per thread
 
-  double allCPU;  //!< Accumulated CPU time from all "main" tasks
-  double allWall; //!< Accumulated wall clock time of all "main" tasks
+  double startTime; //!< Wall clock time when this profiler was created
+  double allCPU;    //!< Accumulated CPU time from all "main" tasks
+  double allWall;   //!< Accumulated wall clock time of all "main" tasks
 
   //! \details When \a nRunners is 1, we are only measuring the total time.
   //! When \a nRunners is 2, we are also measuring a "main" task, which total
@@ -103,18 +152,22 @@ namespace utl
   //! \brief Convenience class to profile the local scope.
   class prof
   {
-    const char* name; //!< Name tag on the local scope to profile
+    size_t id; //!< ID of the local scope to profile
   public:
     //! \brief The constructor starts the profiling of the named task.
-    prof(const char* tag) : name(tag) { if (profiler) profiler->start(name); }
+    prof(const char* tag) : id(Profiler::getID(tag))
+    { if (profiler) profiler->start(id); }
+    //! \brief The constructor starts the profiling of an interned task.
+    prof(size_t tag) : id(tag) { if (profiler) profiler->start(id); }
     //! \brief The destructor stops the profiling.
-    ~prof() { if (profiler) profiler->stop(name); }
+    ~prof() { if (profiler) profiler->stop(id); }
   };
 }
 
 
 //! \brief Macro to add profiling of the local scope.
-#define PROFILE(label) utl::prof _prof(label)
+#define PROFILE(label) \
+  static const size_t _prof_id = Profiler::getID(label); utl::prof _prof(_prof_id)
 
 #if PROFILE_LEVEL >= 1
 #define PROFILE1(label) PROFILE(label)